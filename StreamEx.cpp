@@ -11,6 +11,13 @@
 #include <stdlib.h>     // strtoul, strtoull, strtoll, strtof, strtod
 #include <stdio.h>      // snprintf
 
+#if defined(__SSE2__)
+  #include <emmintrin.h> // SSE2 intrinsics (case folding, hex codec)
+#endif
+#if defined(__SSSE3__)
+  #include <tmmintrin.h> // SSSE3 intrinsics (base64 encode)
+#endif
+
 namespace StreamEx_utility
 {
 
@@ -27,12 +34,9 @@ char tolow(char c) { return (char)tolower((unsigned char)c); }
 bool iequal(const char* a, const char* b)
 {
     if (!a || !b) return false;
-    while (*a && *b)
-    {
-        if (tolow(*a) != tolow(*b)) return false;
-        ++a; ++b;
-    }
-    return *a == '\0' && *b == '\0';
+    const size_t n = strlen(a);
+    if (strlen(b) != n) return false;
+    return iequalN(a, b, n);
 }
 
 bool isNumber(const char* s)
@@ -49,24 +53,6 @@ bool isNumber(const char* s)
     return digit;
 }
 
-bool isInteger(const char* s)
-{
-    if (!s || *s == '\0') return false;
-    if (*s == '+' || *s == '-') ++s;
-    if (*s == '\0') return false;
-    for (; *s; ++s) if (*s < '0' || *s > '9') return false;
-    return true;
-}
-
-bool isUInteger(const char* s)
-{
-    if (!s || *s == '\0' || *s == '-') return false;
-    if (*s == '+') ++s;
-    if (*s == '\0') return false;
-    for (; *s; ++s) if (*s < '0' || *s > '9') return false;
-    return true;
-}
-
 void trimString(char* buf, uint32_t maxSize)
 {
     if (!buf) return;
@@ -151,39 +137,13 @@ bool validateRow(const char* data, size_t expectedColumnCount)
 
 // ---------- Validators (typed) ----------
 
-bool isUInt8 (const char* s){ if(!isUInteger(s)) return false; char* e=nullptr; unsigned long v=strtoul(s,&e,10); return e && *e=='\0' && v<=0xFFUL; }
-bool isUInt16(const char* s){ if(!isUInteger(s)) return false; char* e=nullptr; unsigned long v=strtoul(s,&e,10); return e && *e=='\0' && v<=0xFFFFUL; }
-bool isUInt32(const char* s){ if(!isUInteger(s)) return false; char* e=nullptr; unsigned long v=strtoul(s,&e,10); return e && *e=='\0'; }
-bool isUInt64(const char* s){ if(!isUInteger(s)) return false; char* e=nullptr; (void)strtoull(s,&e,10);          return e && *e=='\0'; }
-
-bool isInt8 (const char* s){ if(!isInteger(s)) return false; char* e=nullptr; long long v=strtoll(s,&e,10); return e && *e=='\0' && v>=INT8_MIN  && v<=INT8_MAX; }
-bool isInt16(const char* s){ if(!isInteger(s)) return false; char* e=nullptr; long long v=strtoll(s,&e,10); return e && *e=='\0' && v>=INT16_MIN && v<=INT16_MAX; }
-bool isInt32(const char* s){ if(!isInteger(s)) return false; char* e=nullptr; long long v=strtoll(s,&e,10); return e && *e=='\0' && v>=INT32_MIN && v<=INT32_MAX; }
-bool isInt64(const char* s){ if(!isInteger(s)) return false; char* e=nullptr; (void)strtoll(s,&e,10);        return e && *e=='\0'; }
-
 bool isFloat (const char* s){ if(!isNumber(s)) return false; char* e=nullptr; (void)strtof (s,&e); return e && *e=='\0'; }
 bool isDouble(const char* s){ if(!isNumber(s)) return false; char* e=nullptr; (void)strtod (s,&e); return e && *e=='\0'; }
 
-bool isBoolean(const char* s)
-{
-    if (!s) return false;
-    if ((s[0]=='0' && s[1]=='\0') || (s[0]=='1' && s[1]=='\0')) return true;
-    // case-insensitive "true"/"false"
-    return iequal(s, "true") || iequal(s, "false");
-}
+int constantParseError() { return 0; }
 
 // ---------- Conversions ----------
 
-bool stringToUint8 (const char* s, uint8_t*  out){ if(!s||!out) return false; char* e=nullptr; unsigned long v=strtoul (s,&e,10); if(!(e&&*e=='\0')||v>0xFFUL)   return false; *out=(uint8_t)v;  return true; }
-bool stringToUint16(const char* s, uint16_t* out){ if(!s||!out) return false; char* e=nullptr; unsigned long v=strtoul (s,&e,10); if(!(e&&*e=='\0')||v>0xFFFFUL) return false; *out=(uint16_t)v; return true; }
-bool stringToUint32(const char* s, uint32_t* out){ if(!s||!out) return false; char* e=nullptr; unsigned long v=strtoul (s,&e,10); if(!(e&&*e=='\0'))            return false; *out=(uint32_t)v; return true; }
-bool stringToUint64(const char* s, uint64_t* out){ if(!s||!out) return false; char* e=nullptr; unsigned long long v=strtoull(s,&e,10); if(!(e&&*e=='\0'))      return false; *out=(uint64_t)v; return true; }
-
-bool stringToInt8 (const char* s, int8_t*  out){ if(!s||!out) return false; char* e=nullptr; long long v=strtoll(s,&e,10); if(!(e&&*e=='\0')||v<INT8_MIN  || v>INT8_MAX)  return false; *out=(int8_t)v;  return true; }
-bool stringToInt16(const char* s, int16_t* out){ if(!s||!out) return false; char* e=nullptr; long long v=strtoll(s,&e,10); if(!(e&&*e=='\0')||v<INT16_MIN || v>INT16_MAX) return false; *out=(int16_t)v; return true; }
-bool stringToInt32(const char* s, int32_t* out){ if(!s||!out) return false; char* e=nullptr; long long v=strtoll(s,&e,10); if(!(e&&*e=='\0')||v<INT32_MIN || v>INT32_MAX) return false; *out=(int32_t)v; return true; }
-bool stringToInt64(const char* s, int64_t* out){ if(!s||!out) return false; char* e=nullptr; long long v=strtoll(s,&e,10); if(!(e&&*e=='\0'))                       return false; *out=(int64_t)v; return true; }
-
 bool stringToFloat (const char* s, float*  out){ if(!s||!out) return false; char* e=nullptr; float  v=strtof(s,&e);  if(!(e&&*e=='\0')) return false; *out=v; return true; }
 bool stringToDouble(const char* s, double* out){ if(!s||!out) return false; char* e=nullptr; double v=strtod(s,&e);  if(!(e&&*e=='\0')) return false; *out=v; return true; }
 
@@ -204,6 +164,8 @@ bool checkValueType(const char *data, dataTypeEnum type)
         case charType:   return true;
         case stringType: return true;
         case boolType:   return isBoolean(data);
+        case q16_16Type: return isQ16_16(data);
+        case q8_24Type:  return isQ8_24 (data);
         default:         return false;
     }
 }
@@ -231,6 +193,9 @@ bool stringToNumber(const char* str, dataValueUnion* num, dataTypeEnum type)
             num->boolValue = (str[0]=='1' && str[1]=='\0') || iequal(str,"true");
             return true;
 
+        case q16_16Type: return stringToQ16_16(str, &num->q16_16Value);
+        case q8_24Type:  return stringToQ8_24 (str, &num->q8_24Value);
+
         case stringType:
         {
             size_t n = safe_strnlen(str, STREAMEX_STRING_CAP - 1);
@@ -254,29 +219,662 @@ void dataValueToString(char *out, size_t outCap,
 
     switch (type)
     {
-        case uint8Type:  snprintf(out, outCap, "%u",   (unsigned)value.uint8Value);            break;
-        case uint16Type: snprintf(out, outCap, "%u",   (unsigned)value.uint16Value);           break;
-        case uint32Type: snprintf(out, outCap, "%lu",  (unsigned long)value.uint32Value);      break;
-        case uint64Type: snprintf(out, outCap, "%llu", (unsigned long long)value.uint64Value); break;
+        case uint8Type:  format(out, outCap, value.uint8Value);  break;
+        case uint16Type: format(out, outCap, value.uint16Value); break;
+        case uint32Type: format(out, outCap, value.uint32Value); break;
+        case uint64Type: format(out, outCap, value.uint64Value); break;
+
+        case int8Type:   format(out, outCap, value.int8Value);   break;
+        case int16Type:  format(out, outCap, value.int16Value);  break;
+        case int32Type:  format(out, outCap, value.int32Value);  break;
+        case int64Type:  format(out, outCap, value.int64Value);  break;
+
+        case floatType:  format(out, outCap, value.floatValue);  break;
+        case doubleType: format(out, outCap, value.doubleValue); break;
+
+        case boolType:   format(out, outCap, value.boolValue);   break;
+        case stringType: formatChars(out, outCap, value.stringValue, safe_strnlen(value.stringValue, STREAMEX_STRING_CAP)); break;
+        case charType:   format(out, outCap, (char)value.uint8Value); break;
+
+        case q16_16Type: formatFixed(out, outCap, value.q16_16Value, STREAMEX_Q16_16_FRAC_BITS, 5); break;
+        case q8_24Type:  formatFixed(out, outCap, value.q8_24Value,  STREAMEX_Q8_24_FRAC_BITS,  8); break;
+
+        default:         formatChars(out, outCap, "Unsupported Type", 16); break;
+    }
+}
+
+size_t dataTypeSize(dataTypeEnum type)
+{
+    switch (type)
+    {
+        case uint8Type:  return sizeof(uint8_t);
+        case uint16Type: return sizeof(uint16_t);
+        case uint32Type: return sizeof(uint32_t);
+        case uint64Type: return sizeof(uint64_t);
+        case int8Type:   return sizeof(int8_t);
+        case int16Type:  return sizeof(int16_t);
+        case int32Type:  return sizeof(int32_t);
+        case int64Type:  return sizeof(int64_t);
+        case floatType:  return sizeof(float);
+        case doubleType: return sizeof(double);
+        case charType:   return sizeof(char);
+        case stringType: return STREAMEX_STRING_CAP;
+        case boolType:   return sizeof(bool);
+        case q16_16Type: return sizeof(int32_t);
+        case q8_24Type:  return sizeof(int32_t);
+        default:         return 0;
+    }
+}
+
+// ---------- Span helpers ----------
+
+// Word-at-a-time (SWAR) ASCII folding. 8-bit AVR keeps the byte loop, which is
+// cheaper there than emulating 32-bit arithmetic.
+#if defined(__AVR__)
+  #define STREAMEX_SWAR 0
+#else
+  #define STREAMEX_SWAR 1
+  #if UINTPTR_MAX > 0xFFFFFFFFUL
+    typedef uint64_t swarWord;
+  #else
+    typedef uint32_t swarWord;
+  #endif
+
+  static const swarWord SWAR_ONES = (swarWord)~(swarWord)0 / 0xFF;   // 0x0101...01
+
+  // Unaligned load without UB (compiles to a single load on targets that allow it).
+  static inline swarWord swarLoad(const char* p) { swarWord w; memcpy(&w, p, sizeof(w)); return w; }
+
+  // Lowercase every 'A'..'Z' byte of w; other bytes (including >= 0x80) are untouched.
+  static inline swarWord swarLower(swarWord w)
+  {
+      const swarWord high    = SWAR_ONES * 0x80;
+      const swarWord low7    = w & ~high;
+      const swarWord geA     = low7 + SWAR_ONES * (0x80 - 'A');   // bit7 set where byte >= 'A'
+      const swarWord gtZ     = low7 + SWAR_ONES * (0x7F - 'Z');   // bit7 set where byte >  'Z'
+      const swarWord isUpper = geA & ~gtZ & ~w & high;
+      return w | (isUpper >> 2);                                 // 0x80 >> 2 == 0x20
+  }
+#endif
+
+#if defined(__SSE2__)
+  // Lowercase 16 ASCII bytes at once.
+  static inline __m128i sseLower(__m128i v)
+  {
+      // Shift 'A'..'Z' to the bottom of the signed range so one compare finds them.
+      const __m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8((char)('A' + 128)));
+      const __m128i isUpper = _mm_cmplt_epi8(shifted, _mm_set1_epi8((char)(-128 + 26)));
+      return _mm_or_si128(v, _mm_and_si128(isUpper, _mm_set1_epi8(0x20)));
+  }
+#endif
+
+void asciiLowerN(char* dst, const char* src, size_t n)
+{
+    if (!dst || !src) return;
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16)
+        _mm_storeu_si128((__m128i*)(dst + i), sseLower(_mm_loadu_si128((const __m128i*)(src + i))));
+#endif
+#if STREAMEX_SWAR
+    for (; i + sizeof(swarWord) <= n; i += sizeof(swarWord))
+    {
+        const swarWord w = swarLower(swarLoad(src + i));
+        memcpy(dst + i, &w, sizeof(w));
+    }
+#endif
+    for (; i < n; ++i) dst[i] = asciiLower(src[i]);
+}
+
+uint32_t ihashN(const char* s, size_t n)
+{
+    uint32_t h = 2166136261UL;
+    size_t i = 0;
+#if STREAMEX_SWAR
+    // Fold a word at a time, then feed the bytes in memory order so the
+    // result is identical to the constexpr ihash().
+    for (; i + sizeof(swarWord) <= n; i += sizeof(swarWord))
+    {
+        unsigned char folded[sizeof(swarWord)];
+        const swarWord w = swarLower(swarLoad(s + i));
+        memcpy(folded, &w, sizeof(w));
+        for (size_t k = 0; k < sizeof(swarWord); ++k) h = (h ^ folded[k]) * 16777619UL;
+    }
+#endif
+    for (; i < n; ++i) h = (h ^ (uint8_t)asciiLower(s[i])) * 16777619UL;
+    return h;
+}
+
+bool iequalN(const char* a, const char* b, size_t n)
+{
+    if (!a || !b) return false;
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i va = sseLower(_mm_loadu_si128((const __m128i*)(a + i)));
+        const __m128i vb = sseLower(_mm_loadu_si128((const __m128i*)(b + i)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xFFFF) return false;
+    }
+#endif
+#if STREAMEX_SWAR
+    for (; i + sizeof(swarWord) <= n; i += sizeof(swarWord))
+    {
+        const swarWord wa = swarLoad(a + i);
+        const swarWord wb = swarLoad(b + i);
+        // Skip the folding work when the raw words already match.
+        if (wa != wb && swarLower(wa) != swarLower(wb)) return false;
+    }
+#endif
+    for (; i < n; ++i) if (asciiLower(a[i]) != asciiLower(b[i])) return false;
+    return true;
+}
+
+bool parseFloat(const char* s, uint32_t n, float* out)
+{
+    // strtof needs a terminator; numbers longer than this are rejected.
+    char tmp[40];
+    if (!s || n == 0 || n >= sizeof(tmp)) return false;
+    memcpy(tmp, s, n);
+    tmp[n] = '\0';
+    return stringToFloat(tmp, out);
+}
+
+bool parseDouble(const char* s, uint32_t n, double* out)
+{
+    char tmp[40];
+    if (!s || n == 0 || n >= sizeof(tmp)) return false;
+    memcpy(tmp, s, n);
+    tmp[n] = '\0';
+    return stringToDouble(tmp, out);
+}
+
+size_t formatDouble(char* out, size_t outCap, double v)
+{
+    const int n = snprintf(out, outCap, "%g", v);
+    return (n < 0) ? 0 : (size_t)n;
+}
+
+// ---------- Fixed point ----------
+
+static const uint32_t POW10[10] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL,
+                                    1000000UL, 10000000UL, 100000000UL, 1000000000UL };
+
+bool parseFixed(const char* s, uint32_t n, uint8_t fracBits, int32_t* out)
+{
+    if (!s || !out || fracBits == 0 || fracBits > 30) return false;
+
+    uint32_t i = 0;
+    bool neg = false;
+    if (i < n && (s[i] == '+' || s[i] == '-')) { neg = (s[i] == '-'); ++i; }
+
+    // Integer part: anything above 2^(31-fracBits) is out of range anyway.
+    const uint32_t intLimit = 1UL << (31 - fracBits);
+    uint32_t ip = 0;
+    uint32_t digits = 0;
+    for (; i < n && isDigit(s[i]); ++i, ++digits)
+    {
+        // Check before multiplying: for small fracBits the limit is above UINT32_MAX / 10.
+        const uint32_t d = (uint32_t)(s[i] - '0');
+        if (d > intLimit || ip > (intLimit - d) / 10) return false;
+        ip = ip * 10 + d;
+    }
+
+    // Fraction: keep up to 9 digits as fracNum / 10^fracDigits.
+    uint32_t fracNum = 0;
+    uint8_t  fracDigits = 0;
+    if (i < n && s[i] == '.')
+    {
+        for (++i; i < n && isDigit(s[i]); ++i, ++digits)
+            if (fracDigits < 9) { fracNum = fracNum * 10 + (uint32_t)(s[i] - '0'); ++fracDigits; }
+    }
+    if (i != n || digits == 0) return false;
+
+    // Round fracNum / 10^d to fracBits binary digits.
+    const uint32_t den = POW10[fracDigits];
+    const uint64_t frac = (((uint64_t)fracNum << fracBits) + den / 2) / den;   // may round up to 1 << fracBits
+    const uint64_t mag  = ((uint64_t)ip << fracBits) + frac;
+
+    if (mag > (neg ? 0x80000000ULL : 0x7FFFFFFFULL)) return false;
+    *out = neg ? (int32_t)(0 - (uint32_t)mag) : (int32_t)mag;
+    return true;
+}
+
+size_t formatFixed(char* out, size_t outCap, int32_t value, uint8_t fracBits, uint8_t decimals)
+{
+    if (fracBits == 0 || fracBits > 30) return formatChars(out, outCap, "", 0);
+    if (decimals > 9) decimals = 9;
+
+    const bool     neg  = value < 0;
+    const uint32_t mag  = neg ? (0 - (uint32_t)value) : (uint32_t)value;
+    const uint32_t mask = (1UL << fracBits) - 1;
+
+    uint32_t ip = mag >> fracBits;
+    // Scaled, rounded fraction in [0, 10^decimals]; carry into the integer part.
+    uint32_t fd = (uint32_t)((((uint64_t)(mag & mask) * POW10[decimals]) + (1ULL << (fracBits - 1))) >> fracBits);
+    if (fd >= POW10[decimals]) { fd -= POW10[decimals]; ++ip; }
+
+    // Trim trailing zeros.
+    while (decimals && fd % 10 == 0) { fd /= 10; --decimals; }
+
+    char tmp[24];
+    size_t len = 0;
+    if (neg && (ip || decimals)) tmp[len++] = '-';
+    len += formatUnsigned<uint32_t>(tmp + len, sizeof(tmp) - len, ip);
+    if (decimals)
+    {
+        tmp[len++] = '.';
+        for (uint8_t d = decimals; d > 0; --d) { tmp[len + d - 1] = (char)('0' + fd % 10); fd /= 10; }
+        len += decimals;
+    }
+    return formatChars(out, outCap, tmp, len);
+}
+
+bool isQ16_16(const char* s){ int32_t v; return s && parseFixed(s, (uint32_t)strlen(s), STREAMEX_Q16_16_FRAC_BITS, &v); }
+bool isQ8_24 (const char* s){ int32_t v; return s && parseFixed(s, (uint32_t)strlen(s), STREAMEX_Q8_24_FRAC_BITS,  &v); }
+
+bool stringToQ16_16(const char* s, int32_t* out){ return s && parseFixed(s, (uint32_t)strlen(s), STREAMEX_Q16_16_FRAC_BITS, out); }
+bool stringToQ8_24 (const char* s, int32_t* out){ return s && parseFixed(s, (uint32_t)strlen(s), STREAMEX_Q8_24_FRAC_BITS,  out); }
+
+// ---------- Radix / hex ----------
+
+bool parseRadix(const char* s, uint32_t n, uint8_t radix, uint64_t maxValue, uint64_t* out)
+{
+    if (!s || !out) return false;
+
+    // Suffix before prefix: "0BEEFh" and "0B0h" are hex numbers, not a "0b" prefix.
+    if (n > 1 && (s[n - 1] | 0x20) == 'h' && (radix == 0 || radix == 16)) { --n; radix = 16; }
+    else if (n > 2 && s[0] == '0')
+    {
+        const char p = (char)(s[1] | 0x20);
+        uint8_t detected = 10;
+        if      (p == 'x') detected = 16;
+        else if (p == 'b') detected = 2;
+        else if (p == 'o') detected = 8;
+        if (detected != 10 && (radix == 0 || radix == detected)) { s += 2; n -= 2; radix = detected; }
+    }
+    if (radix == 0) radix = 10;
+    if (n == 0) return false;
+
+    uint64_t v = 0;
+    if (radix == 10)
+    {
+        if (!parseUnsigned<uint64_t>(s, n, maxValue, &v)) return false;
+    }
+    else
+    {
+        const uint8_t bits = (radix == 16) ? 4 : (radix == 8) ? 3 : (radix == 2) ? 1 : 0;
+        if (!bits) return false;
+        const uint64_t topMask = ~(UINT64_MAX >> bits);   // bits that would be shifted out
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            const uint8_t d = hexValue(s[i]);
+            if (d >= radix) return false;
+            if (v & topMask) return false;
+            v = (v << bits) | d;
+        }
+        if (v > maxValue) return false;
+    }
+    *out = v;
+    return true;
+}
+
+bool checkValueType(const char* data, dataTypeEnum type, uint8_t radix)
+{
+    dataValueUnion v;
+    switch (type)
+    {
+        case uint8Type: case uint16Type: case uint32Type: case uint64Type:
+        case int8Type:  case int16Type:  case int32Type:  case int64Type:
+            return stringToNumber(data, &v, type, radix);
+        default:
+            return checkValueType(data, type);
+    }
+}
+
+bool stringToNumber(const char* str, dataValueUnion* num, dataTypeEnum type, uint8_t radix)
+{
+    if (!str || !num) return false;
+
+    switch (type)
+    {
+        case uint8Type:  return stringToUint8 (str, &num->uint8Value,  radix);
+        case uint16Type: return stringToUint16(str, &num->uint16Value, radix);
+        case uint32Type: return stringToUint32(str, &num->uint32Value, radix);
+        case uint64Type: return stringToUint64(str, &num->uint64Value, radix);
+
+        case int8Type:   return stringToInt8 (str, &num->int8Value,  radix);
+        case int16Type:  return stringToInt16(str, &num->int16Value, radix);
+        case int32Type:  return stringToInt32(str, &num->int32Value, radix);
+        case int64Type:  return stringToInt64(str, &num->int64Value, radix);
+
+        default:         return stringToNumber(str, num, type);
+    }
+}
+
+// Hex-encode n bytes into 2n characters (no terminator).
+static void hexEncodeBlock(char* out, const uint8_t* in, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i nine   = _mm_set1_epi8(9);
+    const __m128i zero   = _mm_set1_epi8('0');
+    const __m128i alpha  = _mm_set1_epi8('A' - '0' - 10);
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i v  = _mm_loadu_si128((const __m128i*)(in + i));
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+        __m128i lo = _mm_and_si128(v, nibble);
+        hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), alpha));
+        lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), alpha));
+        _mm_storeu_si128((__m128i*)(out + 2 * i),      _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        out[2 * i]     = hexDigit((uint8_t)(in[i] >> 4));
+        out[2 * i + 1] = hexDigit(in[i]);
+    }
+}
+
+// Decode up to n hex pairs; stops at the first invalid pair. out may alias text.
+static size_t hexDecodeBlock(uint8_t* out, const char* text, size_t n)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i nine  = _mm_set1_epi8(9);
+    const __m128i five  = _mm_set1_epi8(5);
+    const __m128i ten   = _mm_set1_epi8(10);
+    const __m128i low8  = _mm_set1_epi16(0x00FF);
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m128i c  = _mm_loadu_si128((const __m128i*)(text + 2 * i));
+        const __m128i d  = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+        const __m128i a  = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        const __m128i isD = _mm_cmpeq_epi8(_mm_min_epu8(d, nine), d);
+        const __m128i isA = _mm_cmpeq_epi8(_mm_min_epu8(a, five), a);
+        if (_mm_movemask_epi8(_mm_or_si128(isD, isA)) != 0xFFFF) break;   // let the scalar loop find the stop
+        const __m128i val = _mm_or_si128(_mm_and_si128(isD, d), _mm_and_si128(isA, _mm_add_epi8(a, ten)));
+        // Each 16-bit lane holds (hi, lo) → (hi << 4) | lo.
+        const __m128i bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(val, low8), 4), _mm_srli_epi16(val, 8));
+        _mm_storel_epi64((__m128i*)(out + i), _mm_packus_epi16(bytes, bytes));
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        const uint8_t hi = hexValue(text[2 * i]);
+        const uint8_t lo = hexValue(text[2 * i + 1]);
+        if ((hi | lo) & 0xF0) break;
+        out[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return i;
+}
+
+static const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Value of a base64 character, or 0xFF.
+static inline uint8_t base64Value(char c)
+{
+    if (c >= 'A' && c <= 'Z') return (uint8_t)(c - 'A');
+    if (c >= 'a' && c <= 'z') return (uint8_t)(c - 'a' + 26);
+    if (c >= '0' && c <= '9') return (uint8_t)(c - '0' + 52);
+    if (c == '+') return 62;
+    if (c == '/') return 63;
+    return 0xFF;
+}
+
+// Encode whole 3-byte groups into 4 characters each (no padding, no terminator).
+static void base64EncodeGroups(char* out, const uint8_t* in, size_t groups)
+{
+    size_t g = 0;
+#if defined(__SSSE3__)
+    // 12 input bytes → 16 characters per step; the load reads 16 bytes, so keep
+    // at least 4 spare input bytes (W. Muła / D. Lemire method).
+    const __m128i shuf = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i lut  = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                       '/' - 63, 'A', 0, 0);
+    for (; (g + 4) * 3 + 4 <= groups * 3; g += 4)
+    {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(in + g * 3)), shuf);
+        const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        const __m128i idx = _mm_or_si128(t0, t1);
+        __m128i r = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+        r = _mm_or_si128(r, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+        _mm_storeu_si128((__m128i*)(out + g * 4), _mm_add_epi8(_mm_shuffle_epi8(lut, r), idx));
+    }
+#endif
+    for (; g < groups; ++g)
+    {
+        const uint8_t* p = in + g * 3;
+        const uint32_t w = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+        char* o = out + g * 4;
+        o[0] = BASE64_ALPHABET[(w >> 18) & 0x3F];
+        o[1] = BASE64_ALPHABET[(w >> 12) & 0x3F];
+        o[2] = BASE64_ALPHABET[(w >> 6)  & 0x3F];
+        o[3] = BASE64_ALPHABET[w & 0x3F];
+    }
+}
+
+// Encode the final 1 or 2 bytes as one padded quantum.
+static void base64EncodeTail(char* out, const uint8_t* in, size_t n)
+{
+    const uint32_t w = ((uint32_t)in[0] << 16) | ((n > 1) ? ((uint32_t)in[1] << 8) : 0);
+    out[0] = BASE64_ALPHABET[(w >> 18) & 0x3F];
+    out[1] = BASE64_ALPHABET[(w >> 12) & 0x3F];
+    out[2] = (n > 1) ? BASE64_ALPHABET[(w >> 6) & 0x3F] : '=';
+    out[3] = '=';
+}
+
+// Decode one 4-character quantum. Returns bytes produced (1..3), or 0 if invalid.
+static uint8_t base64DecodeQuantum(uint8_t* out, const char* q)
+{
+    const uint8_t a = base64Value(q[0]);
+    const uint8_t b = base64Value(q[1]);
+    if ((a | b) & 0xC0) return 0;
+    if (q[2] == '=')
+    {
+        if (q[3] != '=') return 0;
+        out[0] = (uint8_t)((a << 2) | (b >> 4));
+        return 1;
+    }
+    const uint8_t c = base64Value(q[2]);
+    if (c & 0xC0) return 0;
+    if (q[3] == '=')
+    {
+        out[0] = (uint8_t)((a << 2) | (b >> 4));
+        out[1] = (uint8_t)((b << 4) | (c >> 2));
+        return 2;
+    }
+    const uint8_t d = base64Value(q[3]);
+    if (d & 0xC0) return 0;
+    out[0] = (uint8_t)((a << 2) | (b >> 4));
+    out[1] = (uint8_t)((b << 4) | (c >> 2));
+    out[2] = (uint8_t)((c << 6) | d);
+    return 3;
+}
+
+// Decode whole quanta from text; stops after a padded quantum, at an invalid one,
+// or when fewer than 3 output bytes remain. Reports characters consumed.
+static size_t base64DecodeQuanta(uint8_t* out, size_t outCap, const char* text, size_t size, size_t* consumed)
+{
+    size_t n = 0, i = 0;
+    uint8_t tmp[3];
+    while (i + 4 <= size)
+    {
+        const uint8_t k = base64DecodeQuantum(tmp, text + i);
+        if (k == 0 || n + k > outCap) break;
+        memcpy(out + n, tmp, k);      // via tmp: out may alias text
+        n += k;
+        i += 4;
+        if (k < 3) break;             // padding ends the stream
+    }
+    *consumed = i;
+    return n;
+}
+
+size_t hexEncode(char* out, size_t outCap, const uint8_t* data, size_t size)
+{
+    if (!out || outCap == 0) return 0;
+    if (!data) size = 0;
+    const size_t bytes = std::min<size_t>(size, (outCap - 1) / 2);
+    hexEncodeBlock(out, data, bytes);
+    out[2 * bytes] = '\0';
+    return 2 * bytes;
+}
+
+bool hexDecode(uint8_t* out, size_t outCap, const char* text, size_t size, size_t* written)
+{
+    size_t n = 0;
+    bool ok = (out && text && (size % 2) == 0);
+    if (ok)
+    {
+        const size_t pairs = std::min<size_t>(size / 2, outCap);
+        n = hexDecodeBlock(out, text, pairs);
+        ok = (n == size / 2);
+    }
+    if (written) *written = n;
+    return ok;
+}
+
+size_t base64Encode(char* out, size_t outCap, const uint8_t* data, size_t size)
+{
+    if (!out || outCap == 0) return 0;
+    if (!data) size = 0;
+    const size_t quanta = std::min<size_t>((size + 2) / 3, (outCap - 1) / 4);
+    const size_t groups = std::min<size_t>(size / 3, quanta);
+    base64EncodeGroups(out, data, groups);
+    size_t len = groups * 4;
+    if (quanta > groups) { base64EncodeTail(out + len, data + groups * 3, size - groups * 3); len += 4; }
+    out[len] = '\0';
+    return len;
+}
+
+bool base64Decode(uint8_t* out, size_t outCap, const char* text, size_t size, size_t* written)
+{
+    size_t n = 0;
+    bool ok = (out && text && (size % 4) == 0);
+    if (ok)
+    {
+        size_t consumed = 0;
+        n = base64DecodeQuanta(out, outCap, text, size, &consumed);
+        ok = (consumed == size);
+    }
+    if (written) *written = n;
+    return ok;
+}
+
+bool stringToNumber(const char* str, uint32_t len, dataValueUnion* num, dataTypeEnum type)
+{
+    if (!str || !num) return false;
+
+    switch (type)
+    {
+        case uint8Type:  return parse(str, len, &num->uint8Value);
+        case uint16Type: return parse(str, len, &num->uint16Value);
+        case uint32Type: return parse(str, len, &num->uint32Value);
+        case uint64Type: return parse(str, len, &num->uint64Value);
+
+        case int8Type:   return parse(str, len, &num->int8Value);
+        case int16Type:  return parse(str, len, &num->int16Value);
+        case int32Type:  return parse(str, len, &num->int32Value);
+        case int64Type:  return parse(str, len, &num->int64Value);
+
+        case floatType:  return parse(str, len, &num->floatValue);
+        case doubleType: return parse(str, len, &num->doubleValue);
+        case boolType:   return parse(str, len, &num->boolValue);
+
+        case q16_16Type: return parseFixed(str, len, STREAMEX_Q16_16_FRAC_BITS, &num->q16_16Value);
+        case q8_24Type:  return parseFixed(str, len, STREAMEX_Q8_24_FRAC_BITS,  &num->q8_24Value);
+
+        case stringType:
+        {
+            const uint32_t n = std::min<uint32_t>(len, STREAMEX_STRING_CAP - 1);
+            memcpy(num->stringValue, str, n);
+            num->stringValue[n] = '\0';
+            return true;
+        }
+
+        case charType:
+            num->uint8Value = (uint8_t)(len ? str[0] : '\0');
+            return true;
+
+        default: return false;
+    }
+}
 
-        case int8Type:   snprintf(out, outCap, "%d",   (int)value.int8Value);                  break;
-        case int16Type:  snprintf(out, outCap, "%d",   (int)value.int16Value);                 break;
-        case int32Type:  snprintf(out, outCap, "%ld",  (long)value.int32Value);                break;
-        case int64Type:  snprintf(out, outCap, "%lld", (long long)value.int64Value);           break;
+bool stringToValue(const char* str, uint32_t len, dataValue* out, dataTypeEnum type)
+{
+    if (!str || !out) return false;
+    if (type == stringType) { out->setView(str, len); return true; }
+    dataValueUnion v;
+    if (!stringToNumber(str, len, &v, type)) return false;
+    out->fromUnion(v, type);
+    return true;
+}
 
-        case floatType:  snprintf(out, outCap, "%g",   (double)value.floatValue);              break;
-        case doubleType: snprintf(out, outCap, "%g",   (double)value.doubleValue);             break;
+bool parseRow(const char* data, uint32_t len, const dataTypeEnum* types, dataValue* out, size_t columnCount)
+{
+    if (!data || !types || !out || columnCount == 0) return false;
 
-        case boolType:   snprintf(out, outCap, "%s",   value.boolValue ? "true" : "false");    break;
-        case stringType: snprintf(out, outCap, "%s",   value.stringValue);                     break;
-        case charType:   snprintf(out, outCap, "%c",   (char)value.uint8Value);                break;
+    const char* p   = data;
+    const char* end = data + len;
+    for (size_t col = 0; col < columnCount; ++col)
+    {
+        const char* comma = static_cast<const char*>(memchr(p, ',', (size_t)(end - p)));
+        const char* fEnd  = comma ? comma : end;
+        if ((comma == nullptr) != (col + 1 == columnCount)) return false;   // column count mismatch
+
+        const char* f = p;
+        while (f < fEnd && (*f == ' ' || *f == '\t')) ++f;
+        while (fEnd > f && (fEnd[-1] == ' ' || fEnd[-1] == '\t')) --fEnd;
+        if (f == fEnd) return false;   // empty field
 
-        default:         snprintf(out, outCap, "%s",   "Unsupported Type");                    break;
+        if (!stringToValue(f, (uint32_t)(fEnd - f), &out[col], types[col])) return false;
+        p = comma ? comma + 1 : end;
     }
+    return true;
 }
 
 } // namespace StreamEx_utility
 
+// ###########################################################################################################
+//                                        dataValue
+// ###########################################################################################################
+
+void dataValue::fromUnion(const dataValueUnion& value, dataTypeEnum type)
+{
+    memset(_raw, 0, sizeof(_raw));
+    _type = (uint8_t)type;
+    _inline = 0;
+    if (type == stringType)
+    {
+        const uint32_t n = (uint32_t)StreamEx_utility::safe_strnlen(value.stringValue, STREAMEX_STRING_CAP - 1);
+        if (!setString(value.stringValue, n)) setView(value.stringValue, n);
+        return;
+    }
+    const size_t n = StreamEx_utility::dataTypeSize(type);
+    if (n) memcpy(_raw, &value, n);
+}
+
+bool dataValue::toUnion(dataValueUnion* value, dataTypeEnum* type) const
+{
+    if (!value || _type == noneType) return false;
+    if (type) *type = (dataTypeEnum)_type;
+    if (_type == stringType)
+    {
+        const uint32_t n = std::min<uint32_t>(stringSize(), STREAMEX_STRING_CAP - 1);
+        if (n) memcpy(value->stringValue, stringData(), n);
+        value->stringValue[n] = '\0';
+        return true;
+    }
+    memcpy(value, _raw, StreamEx_utility::dataTypeSize((dataTypeEnum)_type));
+    return true;
+}
+
 
 // ###########################################################################################################
 //                                        StreamEx class
@@ -298,55 +896,526 @@ StreamEx::~StreamEx() { /* no-op (no ownership) */ }
 
 void StreamEx::setTxBuffer(char* txBuffer, uint32_t txBufferSize)
 {
+    // A plain linear buffer ends segmented, bip and ping-pong mode.
+    if (_txPool) { _txChunks.clear(*_txPool); _txPool = nullptr; }
+    _txBip.init(nullptr, 0);
+    _txReserved = 0;
+    _txMirror = nullptr;
+    _txSpare = nullptr;
+    txDmaComplete();
     _txBuffer      = txBuffer;
     _txBufferSize  = txBufferSize;
     _txPosition    = 0;
     if (_txBuffer && _txBufferSize) memset(_txBuffer, 0, _txBufferSize);
+    _watchTx();
 }
 
 void StreamEx::setRxBuffer(char* rxBuffer, uint32_t rxBufferSize)
 {
+    // A plain linear buffer ends segmented, bip and DMA ring mode.
+    if (_rxPool) { _rxChunks.clear(*_rxPool); _rxPool = nullptr; }
+    _rxBip.init(nullptr, 0);
+    _rxReserved    = 0;
+    _rxMirror      = nullptr;
+    _rxRing        = nullptr;
     _rxBuffer      = rxBuffer;
     _rxBufferSize  = rxBufferSize;
     _rxPosition    = 0;
+    _resetRxStamps();
     if (_rxBuffer && _rxBufferSize) memset(_rxBuffer, 0, _rxBufferSize);
+    _watchRx();
+}
+
+void StreamEx::setTxPool(StreamExChunkPool* pool, uint16_t quota)
+{
+    _txReserved = 0;
+    if (_txPool) _txChunks.clear(*_txPool);
+    _txBip.init(nullptr, 0);
+    _txMirror   = nullptr;
+    _txSpare    = nullptr;
+    _txPool     = pool;
+    _txQuota    = quota;
+    _txPosition = 0;
+    if (_txBuffer && _txBufferSize) _txBuffer[0] = '\0';
+    _watchTx();
+}
+
+void StreamEx::setRxPool(StreamExChunkPool* pool, uint16_t quota)
+{
+    _rxReserved = 0;
+    if (_rxPool) _rxChunks.clear(*_rxPool);
+    _rxBip.init(nullptr, 0);
+    _rxMirror   = nullptr;
+    _rxRing     = nullptr;
+    _rxPool     = pool;
+    _rxQuota    = quota;
+    _rxPosition = 0;
+    _resetRxStamps();
+    if (_rxBuffer && _rxBufferSize) _rxBuffer[0] = '\0';
+    _watchRx();
+}
+
+void StreamEx::setTxPingPong(char* bufferA, char* bufferB, uint32_t size)
+{
+    setTxBuffer(bufferA, size);
+    _txSpare   = bufferB;
+    _txDmaSize = 0;
+    if (_txSpare && size) memset(_txSpare, 0, size);
+}
+
+const char* StreamEx::txDmaStart(uint32_t* size)
+{
+    if (size) *size = 0;
+    if (!_txSpare || _txPosition == 0 || _txPaused || txDmaBusy()) return nullptr;
+
+    // The filled half becomes the stable DMA region; appends continue in the other half.
+    char* region = _txBuffer;
+    _txReserved  = 0;
+    _txBuffer    = _txSpare;
+    _txSpare     = region;
+    _txDmaSize   = _txPosition;
+    _txPosition  = 0;
+    _txBuffer[0] = '\0';
+    __atomic_store_n(&_txDmaBusy, (uint8_t)1, __ATOMIC_RELEASE);
+
+    _watchTx();
+
+    if (size) *size = _txDmaSize;
+    return region;
+}
+
+void StreamEx::setTxBip(char* buffer, uint32_t size)
+{
+    if (!buffer) { setTxBuffer(_txBuffer, _txBufferSize); return; }
+    if (_txPool) { _txChunks.clear(*_txPool); _txPool = nullptr; }
+    _txSpare    = nullptr;
+    _txMirror   = nullptr;
+    txDmaComplete();
+    _txBip.init(buffer, size);
+    _txReserved = 0;
+    _txPosition = 0;
+    _watchTx();
+}
+
+void StreamEx::setRxBip(char* buffer, uint32_t size)
+{
+    if (!buffer) { setRxBuffer(_rxBuffer, _rxBufferSize); return; }
+    if (_rxPool) { _rxChunks.clear(*_rxPool); _rxPool = nullptr; }
+    _rxRing     = nullptr;
+    _rxMirror   = nullptr;
+    _rxBip.init(buffer, size);
+    _rxReserved = 0;
+    _rxPosition = 0;
+    _resetRxStamps();
+    _watchRx();
+}
+
+void StreamEx::setTxMirror(char* base, uint32_t size)
+{
+    // Skip setTxBuffer()'s memset: a large mapping should only be touched as it fills.
+    setTxBuffer(nullptr, 0);
+    if (!base || size == 0) return;
+    _txBuffer     = base;
+    _txBufferSize = size;
+    _txMirror     = base;
+    _txBuffer[0]  = '\0';
+}
+
+void StreamEx::setRxMirror(char* base, uint32_t size)
+{
+    setRxBuffer(nullptr, 0);
+    if (!base || size == 0) return;
+    _rxBuffer     = base;
+    _rxBufferSize = size;
+    _rxMirror     = base;
+    _rxBuffer[0]  = '\0';
+}
+
+char* StreamEx::reserveTx(uint32_t size)
+{
+    char* w = nullptr;
+    if (_txBip.data) w = _txBip.reserve(size);
+    else if (_txLinear() && _txBuffer && size && size <= freeTx()) { w = _txBuffer + _txPosition; _txReserved = size; }
+    if (!w) errorCode = StreamExError::BufferOverflow;
+    return w;
+}
+
+bool StreamEx::commitTx(uint32_t size)
+{
+    if (_txBip.data) {
+        if (!_txBip.commit(size)) return false;
+        _txPosition = _txBip.size();
+        _watchTx();
+        return true;
+    }
+    // The reservation is void once TX was appended to, consumed or switched mode.
+    if (size > _txReserved || !_txBuffer || _txPosition + size >= _txBufferSize) { _txReserved = 0; return false; }
+    _txReserved  = 0;
+    _txPosition += size;
+    _txBuffer[_txPosition] = '\0';
+    _watchTx();
+    return true;
+}
+
+char* StreamEx::reserveRx(uint32_t size)
+{
+    char* w = nullptr;
+    if (_rxBip.data) { _rxBip.pack(size); w = _rxBip.reserve(size); }
+    else if (_rxLinear() && _rxBuffer && size && size <= freeRx()) { w = _rxBuffer + _rxPosition; _rxReserved = size; }
+    if (!w) errorCode = StreamExError::BufferOverflow;
+    return w;
+}
+
+bool StreamEx::commitRx(uint32_t size)
+{
+    if (_rxBip.data) {
+        if (!_rxBip.commit(size)) return false;
+        _rxPosition = _rxBip.size();
+        _watchRx();
+        return true;
+    }
+    if (size > _rxReserved || !_rxBuffer || _rxPosition + size >= _rxBufferSize) { _rxReserved = 0; return false; }
+    _rxReserved  = 0;
+    _rxPosition += size;
+    _rxBuffer[_rxPosition] = '\0';
+    _watchRx();
+    return true;
+}
+
+void StreamEx::setRxDmaRing(char* ring, uint32_t size, uint32_t slack)
+{
+    _rxReserved    = 0;
+    if (_rxPool) { _rxChunks.clear(*_rxPool); _rxPool = nullptr; }
+    _rxBip.init(nullptr, 0);
+    _rxMirror      = nullptr;
+    _rxRing        = (ring && size) ? ring : nullptr;
+    _rxRingSize    = size;
+    _rxRingSlack   = slack;
+    _rxRingIndex   = 0;
+    _rxRingMirrored = 0;
+    _rxRingRead    = 0;
+    _rxRingDmaPos  = 0;
+    _rxPosition    = 0;
+    _resetRxStamps();
+#if defined(__AVR__)
+    _rxRingWritten = 0;   // DMA/ISR not running yet (see header note)
+#else
+    __atomic_store_n(&_rxRingWritten, (uint32_t)0, __ATOMIC_RELEASE);
+#endif
+    _watchRx();
+}
+
+void StreamEx::rxDmaPosition(uint32_t position)
+{
+    if (!_rxRing || position > _rxRingSize) return;
+    if (position == _rxRingSize) position = 0;   // transfer complete: the DMA wrapped
+
+    const uint32_t last  = _rxRingDmaPos;
+    const uint32_t delta = (position >= last) ? (position - last) : (position + _rxRingSize - last);
+    _rxRingDmaPos = position;
+    // Single writer: the thread side only ever loads this counter.
+#if defined(__AVR__)
+    _rxRingWritten = _rxRingWritten + delta;   // called with interrupts masked (ISR)
+#else
+    __atomic_store_n(&_rxRingWritten, _rxRingWritten + delta, __ATOMIC_RELEASE);
+#endif
+}
+
+void StreamEx::setTxWatermarks(uint32_t low, uint32_t high)
+{
+    _txWatch.low   = (low < high) ? low : (high ? high - 1 : 0);
+    _txWatch.high  = high;
+    _txWatch.above = false;
+    _watchTx();
+}
+
+void StreamEx::setRxWatermarks(uint32_t low, uint32_t high)
+{
+    _rxWatch.low   = (low < high) ? low : (high ? high - 1 : 0);
+    _rxWatch.high  = high;
+    _rxWatch.above = false;
+    _syncRx();
+    _watchRx();
+}
+
+void StreamEx::_watch(Watermark& w, uint32_t fill, StreamExWatermark high, StreamExWatermark low)
+{
+    StreamExWatermark event;
+    if (!w.above && fill >= w.high)     { w.above = true;  event = high; }
+    else if (w.above && fill <= w.low)  { w.above = false; event = low; }
+    else return;
+
+    // State is updated first: the handler may touch the stream again (e.g. queue XOFF).
+    _watchEvents |= (uint8_t)event;
+    if (_flowMode != StreamExFlowControl::None && &w == &_rxWatch)
+    {
+        const bool stop = (event == StreamExWatermark::RxHigh);
+        if (_flowMode == StreamExFlowControl::XonXoff) _txControl = stop ? STREAMEX_XOFF : STREAMEX_XON;
+        if (_flowHandler) _flowHandler(*this, stop, _flowContext);
+    }
+    if (_watchHandler) _watchHandler(*this, event, _watchContext);
+}
+
+void StreamEx::setFlowControl(StreamExFlowControl mode, StreamExFlowHandler handler, void* context)
+{
+    _flowMode    = mode;
+    _flowHandler = (mode == StreamExFlowControl::None) ? nullptr : handler;
+    _flowContext = context;
+    _txControl   = -1;
+    _txPaused    = false;
+}
+
+void StreamEx::setRxTimestamps(StreamExRxStamp* stamps, uint16_t count)
+{
+    _rxStamps     = (stamps && count) ? stamps : nullptr;
+    _rxStampCount = _rxStamps ? count : 0;
+    _resetRxStamps();
+}
+
+void StreamEx::_stampRx(uint32_t time)
+{
+    if (!_rxStamps || _rxRing) return;
+    const uint32_t end = _rxConsumed + _rxPosition;
+    if (_rxStampSize)
+    {
+        StreamExRxStamp& last = _rxStamps[(uint16_t)((_rxStampHead + _rxStampSize - 1) % _rxStampCount)];
+        if (last.end == end) return;                                  // nothing was stored
+        if (_rxStampSize == _rxStampCount) { last.end = end; return; }  // full: merge into the newest
+    }
+    else if (_rxPosition == 0) return;
+
+    StreamExRxStamp& rec = _rxStamps[(uint16_t)((_rxStampHead + _rxStampSize) % _rxStampCount)];
+    rec.end  = end;
+    rec.time = time;
+    ++_rxStampSize;
+}
+
+bool StreamEx::rxTimestamp(uint32_t offset, uint32_t* time) const
+{
+    if (!_rxStamps || !time || offset >= _rxPosition || _rxStampSize == 0) return false;
+
+    // Fast path: the oldest record covers the bytes about to be read.
+    const StreamExRxStamp& head = _rxStamps[_rxStampHead];
+    if (head.end - _rxConsumed > offset) { *time = head.time; return true; }
+
+    // Record ends increase along the ring: find the first one past the byte.
+    uint16_t lo = 1, hi = _rxStampSize;
+    while (lo < hi)
+    {
+        const uint16_t mid = (uint16_t)((lo + hi) / 2);
+        const StreamExRxStamp& rec = _rxStamps[(uint16_t)((_rxStampHead + mid) % _rxStampCount)];
+        if (rec.end - _rxConsumed > offset) hi = mid; else lo = (uint16_t)(mid + 1);
+    }
+    if (lo == _rxStampSize) return false;
+    *time = _rxStamps[(uint16_t)((_rxStampHead + lo) % _rxStampCount)].time;
+    return true;
+}
+
+void StreamEx::setTxRate(uint32_t bytesPerSecond, uint32_t burst)
+{
+    _txRate        = bytesPerSecond;
+    _txBurst       = burst ? burst : 1;
+    _txTokens      = (uint64_t)_txBurst * 1000000u;
+    _txPaceStarted = false;
+    _txThrottled   = false;
+    _txThrottledUs = 0;
+}
+
+uint32_t StreamEx::popTxPaced(char* out, uint32_t maxSize, uint32_t nowUs)
+{
+    if (!out) { errorCode = StreamExError::NullData; return 0; }
+    uint32_t want = std::min<uint32_t>(_txPosition, maxSize);
+
+    if (_txRate)
+    {
+        // Refill: elapsed × rate fits 64 bits for any 32-bit operands.
+        if (_txPaceStarted)
+        {
+            const uint32_t elapsed = nowUs - _txPaceLast;
+            if (_txThrottled) _txThrottledUs += elapsed;
+            const uint64_t room = (uint64_t)_txBurst * 1000000u - _txTokens;
+            const uint64_t add  = (uint64_t)elapsed * _txRate;
+            _txTokens += (add < room) ? add : room;
+        }
+        _txPaceLast    = nowUs;
+        _txPaceStarted = true;
+
+        const uint64_t allowed = _txTokens / 1000000u;
+        _txThrottled = (want > allowed) && !_txPaused;
+        if (want > allowed) want = (uint32_t)allowed;
+    }
+
+    if (want == 0 || _txPaused) return 0;
+    _peekTx(out, want);   // want ≤ availableTx(): always complete
+    _dropFrontTx(want);
+    if (_txRate) _txTokens -= (uint64_t)want * 1000000u;
+    return want;
+}
+
+uint32_t StreamEx::txPaceWaitUs(uint32_t size) const
+{
+    const uint64_t need = (uint64_t)std::min<uint32_t>(size, _txBurst) * 1000000u;
+    if (_txRate == 0 || _txTokens >= need) return 0;
+    const uint64_t us = (need - _txTokens + _txRate - 1) / _txRate;
+    return (us > UINT32_MAX) ? UINT32_MAX : (uint32_t)us;
+}
+
+uint32_t StreamEx::freeTx() const
+{
+    if (_txPool) return _txChunks.room(*_txPool, _txQuota);
+    if (_txBip.data) return _txBip.largestFree();
+    return (_txBuffer && _txBufferSize > _txPosition) ? (_txBufferSize - _txPosition - 1) : 0;
+}
+
+uint32_t StreamEx::freeRx() const
+{
+    if (_rxPool) return _rxChunks.room(*_rxPool, _rxQuota);
+    if (_rxBip.data) return _rxBip.capacity - _rxBip.size();   // RX packs instead of opening B
+    if (_rxRing) return _rxRingSize - availableRx();
+    return (_rxBuffer && _rxBufferSize > _rxPosition) ? (_rxBufferSize - _rxPosition - 1) : 0;
 }
 
 void StreamEx::clearTxBuffer() 
 {
-    if (_txBuffer && _txBufferSize) memset(_txBuffer, 0, _txBufferSize);
+    _txReserved = 0;
+    if (_txPool) _txChunks.clear(*_txPool);
+    else if (_txBip.data) _txBip.clear();
+    else if (_txBuffer && _txBufferSize) memset(_txBuffer, 0, _txBufferSize);
     _txPosition = 0;
+    _watchTx();
 }
 
 void StreamEx::clearRxBuffer() 
 {
-    if (_rxBuffer && _rxBufferSize) memset(_rxBuffer, 0, _rxBufferSize);
+    _rxReserved = 0;
+    if (_rxRing) { _syncRx(); _dropFrontRx(_rxPosition); return; }
+    if (_rxPool) _rxChunks.clear(*_rxPool);
+    else if (_rxBip.data) _rxBip.clear();
+    else if (_rxBuffer && _rxBufferSize) memset(_rxBuffer, 0, _rxBufferSize);
+    _consumedRx(_rxPosition);
     _rxPosition = 0;
+    _watchRx();
 }
 
 // ----- internal helpers -----
 
-void StreamEx::_dropFrontTx(uint32_t n){
+void StreamEx::_shrinkTx(uint32_t n){
+    _txReserved = 0;   // linear data moves: an open reservation is stale
+    if (_txPool) { _txChunks.drop(*_txPool, n); _txPosition = _txChunks.size; return; }
+    if (_txBip.data) { _txBip.drop(n); _txPosition = _txBip.size(); return; }
     if (!_txBuffer || _txPosition == 0 || n == 0) return;
     if (n >= _txPosition) { _txPosition = 0; _txBuffer[0] = '\0'; return; }
+    if (_txMirror) {
+        // Mirrored: move the view instead of the bytes (the NUL slot aliases free space).
+        _txBuffer += n;
+        if (_txBuffer >= _txMirror + _txBufferSize) _txBuffer -= _txBufferSize;
+        _txPosition -= n;
+        _txBuffer[_txPosition] = '\0';
+        return;
+    }
     memmove(_txBuffer, _txBuffer + n, _txPosition - n);
     _txPosition -= n;
     _txBuffer[_txPosition] = '\0';
 }
 
-void StreamEx::_dropFrontRx(uint32_t n){
+void StreamEx::_peekTx(char* out, uint32_t n) const {
+    if (_txPool) _txChunks.peek(out, n);
+    else if (_txBip.data) _txBip.peek(out, n);
+    else memcpy(out, _txBuffer, n);
+}
+
+void StreamEx::_peekRx(char* out, uint32_t n) const {
+    if (_rxPool) _rxChunks.peek(out, n);
+    else if (_rxBip.data) _rxBip.peek(out, n);
+    else if (_rxRing) {
+        const uint32_t first = std::min<uint32_t>(n, _rxRingSize - _rxRingIndex);
+        memcpy(out, _rxRing + _rxRingIndex, first);
+        memcpy(out + first, _rxRing, n - first);
+    }
+    else memcpy(out, _rxBuffer, n);
+}
+
+void StreamEx::_shrinkRx(uint32_t n){
+    _rxReserved = 0;
+    if (_rxPool) { _rxChunks.drop(*_rxPool, n); _rxPosition = _rxChunks.size; return; }
+    if (_rxBip.data) { _rxBip.drop(n); _rxPosition = _rxBip.size(); return; }
+    if (_rxRing) {
+        if (n > _rxPosition) n = _rxPosition;
+        _rxRingRead  += n;
+        _rxRingIndex += n;
+        // Crossing the ring end: the mirrored bytes are now read in place.
+        if (_rxRingIndex >= _rxRingSize) { _rxRingIndex -= _rxRingSize; _rxRingMirrored = 0; }
+        _rxPosition  -= n;
+        return;
+    }
     if (!_rxBuffer || _rxPosition == 0 || n == 0) return;
     if (n >= _rxPosition) { _rxPosition = 0; _rxBuffer[0] = '\0'; return; }
+    if (_rxMirror) {
+        _rxBuffer += n;
+        if (_rxBuffer >= _rxMirror + _rxBufferSize) _rxBuffer -= _rxBufferSize;
+        _rxPosition -= n;
+        _rxBuffer[_rxPosition] = '\0';
+        return;
+    }
     memmove(_rxBuffer, _rxBuffer + n, _rxPosition - n);
     _rxPosition -= n;
     _rxBuffer[_rxPosition] = '\0';
 }
 
+void StreamEx::_syncRx(){
+    if (!_rxRing) return;
+    const uint32_t fill = _rxRingWrittenNow() - _rxRingRead;
+    if (fill > _rxRingSize) {
+        // The DMA lapped unread data: what is left is a mix of two laps, drop it all.
+        _rxRingRead += fill;
+        _rxRingIndex = (uint32_t)((_rxRingIndex + (uint64_t)fill) % _rxRingSize);
+        _rxRingMirrored = 0;
+        _rxPosition  = 0;
+        errorCode    = StreamExError::BufferOverflow;
+        _watchRx();
+        return;
+    }
+    _rxPosition = fill;
+
+    // Unread data wraps: mirror the start of the ring behind its end so readers see one
+    // run (the slack belongs to the stream; DMA never writes it). Only new bytes are copied.
+    const uint32_t first   = std::min<uint32_t>(fill, _rxRingSize - _rxRingIndex);
+    const uint32_t wrapped = std::min<uint32_t>(fill - first, _rxRingSlack);
+    if (wrapped > _rxRingMirrored) {
+        memcpy(_rxRing + _rxRingSize + _rxRingMirrored, _rxRing + _rxRingMirrored, wrapped - _rxRingMirrored);
+        _rxRingMirrored = wrapped;
+    }
+    _watchRx();
+}
+
+uint32_t StreamEx::_rxRingContiguous() const {
+    const uint32_t fill  = availableRx();
+    const uint32_t first = std::min<uint32_t>(fill, _rxRingSize - _rxRingIndex);
+    if (fill == first) return first;
+    return first + std::min<uint32_t>(fill - first, _rxRingMirrored);
+}
+
 // ----- append / pop APIs -----
 
 bool StreamEx::writeTxBuffer(const char* data, uint32_t dataSize) 
 {
     if ((data == nullptr && dataSize > 0)) { errorCode = StreamExError::NullData; return false; }
+    _txReserved = 0;
+    if (_txPool) {
+        _txChunks.clear(*_txPool);
+        _txPosition = _txChunks.append(*_txPool, data, dataSize, _txQuota);
+        _watchTx();
+        if (_txPosition != dataSize) { errorCode = StreamExError::BufferOverflow; return false; }
+        return true;
+    }
+    if (_txBip.data) {
+        _txBip.clear();
+        const bool ok = _txBip.append(data, dataSize);
+        _txPosition = _txBip.size();
+        _watchTx();
+        if (!ok) errorCode = StreamExError::BufferOverflow;
+        return ok;
+    }
     if (dataSize > _txBufferSize) { errorCode = StreamExError::BufferOverflow; return false; }
 
     memcpy(_txBuffer, data, dataSize); // Copy data to TX buffer
@@ -356,6 +1425,7 @@ bool StreamEx::writeTxBuffer(const char* data, uint32_t dataSize)
         const uint32_t term = (_txPosition < _txBufferSize) ? _txPosition : (_txBufferSize - 1);
         _txBuffer[term] = '\0';
     }
+    _watchTx();
 
     return true;
 }
@@ -363,6 +1433,24 @@ bool StreamEx::writeTxBuffer(const char* data, uint32_t dataSize)
 bool StreamEx::writeRxBuffer(const char* data, uint32_t dataSize) 
 {
     if ((data == nullptr && dataSize > 0)) { errorCode = StreamExError::NullData; return false; }
+    _rxReserved = 0;
+    if (_rxRing) { errorCode = StreamExError::BufferOverflow; return false; }   // RX is written by DMA
+    _consumedRx(_rxPosition);   // previous content is discarded
+    if (_rxPool) {
+        _rxChunks.clear(*_rxPool);
+        _rxPosition = _rxChunks.append(*_rxPool, data, dataSize, _rxQuota);
+        _watchRx();
+        if (_rxPosition != dataSize) { errorCode = StreamExError::BufferOverflow; return false; }
+        return true;
+    }
+    if (_rxBip.data) {
+        _rxBip.clear();
+        const bool ok = _rxBip.append(data, dataSize);
+        _rxPosition = _rxBip.size();
+        _watchRx();
+        if (!ok) errorCode = StreamExError::BufferOverflow;
+        return ok;
+    }
     if (dataSize > _rxBufferSize) { errorCode = StreamExError::BufferOverflow; return false; }
 
     memcpy(_rxBuffer, data, dataSize); // Copy data to RX buffer
@@ -372,6 +1460,7 @@ bool StreamEx::writeRxBuffer(const char* data, uint32_t dataSize)
         const uint32_t term = (_rxPosition < _rxBufferSize) ? _rxPosition : (_rxBufferSize - 1);
         _rxBuffer[term] = '\0';
     }
+    _watchRx();
 
     return true;
 }
@@ -379,6 +1468,22 @@ bool StreamEx::writeRxBuffer(const char* data, uint32_t dataSize)
 bool StreamEx::pushBackTxBuffer(const char* data, uint32_t dataSize)
 {
     if (!data) { errorCode = StreamExError::NullData; return false; }
+    _txReserved = 0;   // the append lands in the reserved bytes
+    if (_txPool) {
+        // Segmented: store what fits, never drop queued data.
+        const uint32_t n = _txChunks.append(*_txPool, data, dataSize, _txQuota);
+        _txPosition = _txChunks.size;
+        _watchTx();
+        if (n != dataSize) { errorCode = StreamExError::BufferOverflow; return false; }
+        return true;
+    }
+    if (_txBip.data) {
+        // Bip: one contiguous run or nothing; never drop queued data.
+        if (!_txBip.append(data, dataSize)) { errorCode = StreamExError::BufferOverflow; return false; }
+        _txPosition = _txBip.size();
+        _watchTx();
+        return true;
+    }
     if (!_txBuffer || _txBufferSize == 0) { errorCode = StreamExError::BufferOverflow; return false; }
 
     // empty space size of tx buffer.
@@ -388,7 +1493,7 @@ bool StreamEx::pushBackTxBuffer(const char* data, uint32_t dataSize)
     if (dataSize > freeCap){
         // Truncate from the front (sliding window)
         const uint32_t need = dataSize - freeCap;
-        _dropFrontTx(need);
+        _shrinkTx(need);   // refilled below: no watermark crossing in between
         errorCode = StreamExError::BufferOverflow;
     }
 
@@ -398,6 +1503,7 @@ bool StreamEx::pushBackTxBuffer(const char* data, uint32_t dataSize)
         _txPosition += canCopy;
         _txBuffer[_txPosition] = '\0';
     }
+    _watchTx();
     return (canCopy == dataSize);
 }
 
@@ -416,15 +1522,62 @@ bool StreamEx::pushBackTxBuffer(const char* data, uint32_t dataSize)
 #endif
 
 bool StreamEx::pushBackRxBuffer(const char* data, uint32_t dataSize)
+{
+    return pushBackRxBuffer(data, dataSize, _rxStamps ? (uint32_t)micros() : 0);
+}
+
+bool StreamEx::pushBackRxBuffer(const char* data, uint32_t dataSize, uint32_t timestamp)
+{
+    if (_flowMode != StreamExFlowControl::XonXoff || !data)
+    {
+        const bool ok = _appendRx(data, dataSize);
+        _stampRx(timestamp);
+        return ok;
+    }
+
+    // The peer's XON/XOFF steer our TX and never reach the reader.
+    bool ok = true;
+    const char* end = data + dataSize;
+    while (data < end)
+    {
+        const char* c = data;
+        while (c < end && *c != STREAMEX_XON && *c != STREAMEX_XOFF) ++c;
+        if (c > data && !_appendRx(data, (uint32_t)(c - data))) ok = false;
+        if (c < end) { _txPaused = (*c == STREAMEX_XOFF); ++c; }
+        data = c;
+    }
+    _stampRx(timestamp);
+    return ok;
+}
+
+bool StreamEx::_appendRx(const char* data, uint32_t dataSize)
 {
     if (!data) { errorCode = StreamExError::NullData; return false; }
+    _rxReserved = 0;
+    if (_rxRing) { errorCode = StreamExError::BufferOverflow; return false; }   // RX is written by DMA
+    if (_rxPool) {
+        // Segmented: store what fits, never drop unread data.
+        const uint32_t n = _rxChunks.append(*_rxPool, data, dataSize, _rxQuota);
+        _rxPosition = _rxChunks.size;
+        _watchRx();
+        if (n != dataSize) { errorCode = StreamExError::BufferOverflow; return false; }
+        return true;
+    }
+    if (_rxBip.data) {
+        // Never open region B: a line split across appends must stay one run for the parsers.
+        _rxBip.pack(dataSize);
+        if (!_rxBip.append(data, dataSize)) { errorCode = StreamExError::BufferOverflow; return false; }
+        _rxPosition = _rxBip.size();
+        _watchRx();
+        return true;
+    }
     if (!_rxBuffer || _rxBufferSize == 0) { errorCode = StreamExError::BufferOverflow; return false; }
 
     const uint32_t freeCap = (_rxBufferSize > _rxPosition) ? (_rxBufferSize - _rxPosition - 1) : 0;
 
     if (dataSize > freeCap){
         const uint32_t need = dataSize - freeCap;
-        _dropFrontRx(need);
+        _discardRx(need);
         errorCode = StreamExError::BufferOverflow;
     }
 
@@ -434,6 +1587,7 @@ bool StreamEx::pushBackRxBuffer(const char* data, uint32_t dataSize)
         _rxPosition += canCopy;
         _rxBuffer[_rxPosition] = '\0';
     }
+    _watchRx();
     return (canCopy == dataSize);
 }
 
@@ -455,6 +1609,7 @@ bool StreamEx::popFrontTxBuffer(char* data, uint32_t dataSize)
 {
     if (!data) { errorCode = StreamExError::NullData; return false; }
     if (dataSize == 0) { errorCode = StreamExError::SizeZero; return false; }
+    if (_txPaused) { errorCode = StreamExError::NotEnoughData; return false; }   // flow control: hold back
 
     if (dataSize > _txPosition){
         // clamp and signal
@@ -463,7 +1618,7 @@ bool StreamEx::popFrontTxBuffer(char* data, uint32_t dataSize)
     }
 
     if (dataSize == 0) { data[0] = '\0'; return false; }
-    memcpy(data, _txBuffer, dataSize);
+    _peekTx(data, dataSize);
 
     _dropFrontTx(dataSize);
     return (errorCode != StreamExError::NotEnoughData);
@@ -473,11 +1628,13 @@ bool StreamEx::popFrontTxBuffer(char* data, uint32_t dataSize)
     bool StreamEx::popFrontTxBuffer(std::string* out, uint32_t dataSize)
     {
         if (!out) { errorCode = StreamExError::NullData; return false; }
+        if (_txPaused) { out->clear(); errorCode = StreamExError::NotEnoughData; return false; }
         if (dataSize > _txPosition){
             dataSize = _txPosition;
             errorCode = StreamExError::NotEnoughData;
         }
-        out->assign(_txBuffer, _txBuffer + dataSize);
+        out->resize(dataSize);
+        if (dataSize) _peekTx(&(*out)[0], dataSize);
         _dropFrontTx(dataSize);
         return (errorCode != StreamExError::NotEnoughData);
     }
@@ -485,8 +1642,14 @@ bool StreamEx::popFrontTxBuffer(char* data, uint32_t dataSize)
 
 #if STREAMEX_ENABLE_ARDUINO_STRING
     bool StreamEx::popFrontTxBuffer(String& out, uint32_t dataSize) {
+        if (_txPaused) { out.remove(0); errorCode = StreamExError::NotEnoughData; return false; }
         if (dataSize > _txPosition) { dataSize = _txPosition; errorCode = StreamExError::NotEnoughData; }
         out.remove(0); out.reserve(dataSize);
+        if (!_txLinear()) {
+            char c;
+            for (uint32_t i = 0; i < dataSize; ++i) { _peekTx(&c, 1); _dropFrontTx(1); out.concat(c); }
+            return (errorCode != StreamExError::NotEnoughData);
+        }
         char saved = _txBuffer[dataSize];
         _txBuffer[dataSize] = '\0';
         out.concat(_txBuffer);
@@ -499,8 +1662,9 @@ bool StreamEx::popFrontTxBuffer(char* data, uint32_t dataSize)
 bool StreamEx::popAllTxBuffer(char* out, uint32_t maxSize){
     if (!out) { errorCode = StreamExError::NullData; return false; }
     if (maxSize == 0) { errorCode = StreamExError::SizeZero; return false; }
+    if (_txPaused) return false;
     uint32_t take = std::min<uint32_t>(_txPosition, maxSize);
-    memcpy(out, _txBuffer, take);
+    _peekTx(out, take);
     _dropFrontTx(take);
     return (take == maxSize || _txPosition == 0);
 }
@@ -508,7 +1672,9 @@ bool StreamEx::popAllTxBuffer(char* out, uint32_t maxSize){
 #if STREAMEX_ENABLE_STD_STRING
     bool StreamEx::popAllTxBuffer(std::string* out){
         if (!out) { errorCode = StreamExError::NullData; return false; }
-        out->assign(_txBuffer, _txBuffer + _txPosition);
+        if (_txPaused) { out->clear(); return false; }
+        out->resize(_txPosition);
+        if (_txPosition) _peekTx(&(*out)[0], _txPosition);
         _dropFrontTx(_txPosition);
         return true;
     }
@@ -516,7 +1682,14 @@ bool StreamEx::popAllTxBuffer(char* out, uint32_t maxSize){
 
 #if STREAMEX_ENABLE_ARDUINO_STRING
     bool StreamEx::popAllTxBuffer(String& out) {
-        out.remove(0); out.reserve(_txPosition);
+        out.remove(0);
+        if (_txPaused) return false;
+        out.reserve(_txPosition);
+        if (!_txLinear()) {
+            char c;
+            while (_txPosition) { _peekTx(&c, 1); _dropFrontTx(1); out.concat(c); }
+            return true;
+        }
         out.concat(_txBuffer);
         _dropFrontTx(_txPosition);
         return true;
@@ -525,13 +1698,14 @@ bool StreamEx::popAllTxBuffer(char* out, uint32_t maxSize){
 
 bool StreamEx::popFrontRxBuffer(char* out, uint32_t dataSize){
     if (!out) { errorCode = StreamExError::NullData; return false; }
+    _syncRx();
     if (dataSize == 0) { errorCode = StreamExError::SizeZero; return false; }
     if (dataSize > _rxPosition){
         dataSize = _rxPosition;
         errorCode = StreamExError::NotEnoughData;
     }
     if (dataSize == 0) { out[0] = '\0'; return false; }
-    memcpy(out, _rxBuffer, dataSize);
+    _peekRx(out, dataSize);
     _dropFrontRx(dataSize);
     return (errorCode != StreamExError::NotEnoughData);
 }
@@ -539,11 +1713,13 @@ bool StreamEx::popFrontRxBuffer(char* out, uint32_t dataSize){
 #if STREAMEX_ENABLE_STD_STRING
     bool StreamEx::popFrontRxBuffer(std::string* out, uint32_t dataSize){
         if (!out) { errorCode = StreamExError::NullData; return false; }
+        _syncRx();
         if (dataSize > _rxPosition){
             dataSize = _rxPosition;
             errorCode = StreamExError::NotEnoughData;
         }
-        out->assign(_rxBuffer, _rxBuffer + dataSize);
+        out->resize(dataSize);
+        if (dataSize) _peekRx(&(*out)[0], dataSize);
         _dropFrontRx(dataSize);
         return (errorCode != StreamExError::NotEnoughData);
     }
@@ -551,8 +1727,14 @@ bool StreamEx::popFrontRxBuffer(char* out, uint32_t dataSize){
 
 #if STREAMEX_ENABLE_ARDUINO_STRING
     bool StreamEx::popFrontRxBuffer(String& out, uint32_t dataSize) {
+        _syncRx();
         if (dataSize > _rxPosition) { dataSize = _rxPosition; errorCode = StreamExError::NotEnoughData; }
         out.remove(0); out.reserve(dataSize);
+        if (!_rxLinear()) {
+            char c;
+            for (uint32_t i = 0; i < dataSize; ++i) { _peekRx(&c, 1); _dropFrontRx(1); out.concat(c); }
+            return (errorCode != StreamExError::NotEnoughData);
+        }
         char saved = _rxBuffer[dataSize];
         _rxBuffer[dataSize] = '\0';
         out.concat(_rxBuffer);
@@ -565,8 +1747,9 @@ bool StreamEx::popFrontRxBuffer(char* out, uint32_t dataSize){
 bool StreamEx::popAllRxBuffer(char* out, uint32_t maxSize){
     if (!out) { errorCode = StreamExError::NullData; return false; }
     if (maxSize == 0) { errorCode = StreamExError::SizeZero; return false; }
+    _syncRx();
     uint32_t take = std::min<uint32_t>(_rxPosition, maxSize);
-    memcpy(out, _rxBuffer, take);
+    _peekRx(out, take);
     _dropFrontRx(take);
     return (take == maxSize || _rxPosition == 0);
 }
@@ -574,7 +1757,9 @@ bool StreamEx::popAllRxBuffer(char* out, uint32_t maxSize){
 #if STREAMEX_ENABLE_STD_STRING
     bool StreamEx::popAllRxBuffer(std::string* out){
         if (!out) { errorCode = StreamExError::NullData; return false; }
-        out->assign(_rxBuffer, _rxBuffer + _rxPosition);
+        _syncRx();
+        out->resize(_rxPosition);
+        if (_rxPosition) _peekRx(&(*out)[0], _rxPosition);
         _dropFrontRx(_rxPosition);
         return true;
     }
@@ -582,19 +1767,151 @@ bool StreamEx::popAllRxBuffer(char* out, uint32_t maxSize){
 
 #if STREAMEX_ENABLE_ARDUINO_STRING
     bool StreamEx::popAllRxBuffer(String& out) {
+        _syncRx();
         out.remove(0); out.reserve(_rxPosition);
+        if (!_rxLinear()) {
+            char c;
+            while (_rxPosition) { _peekRx(&c, 1); _dropFrontRx(1); out.concat(c); }
+            return true;
+        }
         out.concat(_rxBuffer);
         _dropFrontRx(_rxPosition);
         return true;
     }
 #endif
 
+// ----- streaming codecs -----
+
+uint32_t StreamEx::pushBackTxHex(const uint8_t* data, uint32_t dataSize)
+{
+    if (!data) { errorCode = StreamExError::NullData; return 0; }
+    _txReserved = 0;
+    const uint32_t freeCap = freeTx();
+    const uint32_t take = std::min<uint32_t>(dataSize, freeCap / 2);
+    if (take < dataSize) errorCode = StreamExError::BufferOverflow;
+    if (take == 0) return 0;
+
+    if (!_txLinear()) {
+        // Segmented/bip: encode through a small stack block, then append (space already checked).
+        char block[64 + 1];
+        for (uint32_t done = 0; done < take; ) {
+            const uint32_t n = std::min<uint32_t>(take - done, 32);
+            StreamEx_utility::hexEncode(block, sizeof(block), data + done, n);
+            if (_txPool) _txChunks.append(*_txPool, block, 2 * n, _txQuota);
+            else _txBip.append(block, 2 * n);
+            done += n;
+        }
+        _txPosition = _txPool ? _txChunks.size : _txBip.size();
+        _watchTx();
+        return take;
+    }
+
+    StreamEx_utility::hexEncode(_txBuffer + _txPosition, 2 * take + 1, data, take);
+    _txPosition += 2 * take;
+    _watchTx();
+    return take;
+}
+
+uint32_t StreamEx::pushBackTxBase64(const uint8_t* data, uint32_t dataSize, bool final)
+{
+    if (!data) { errorCode = StreamExError::NullData; return 0; }
+    _txReserved = 0;
+    const uint32_t freeCap = freeTx();
+
+    // Whole groups always; the padded tail only on the final chunk.
+    uint32_t take = std::min<uint32_t>(dataSize / 3, freeCap / 4) * 3;
+    if (final && take + 3 > dataSize && dataSize > take && freeCap / 4 > take / 3) take = dataSize;
+    if (take < (final ? dataSize : dataSize - dataSize % 3)) errorCode = StreamExError::BufferOverflow;
+    if (take == 0) return 0;
+
+    if (!_txLinear()) {
+        char block[64 + 1];
+        for (uint32_t done = 0; done < take; ) {
+            const uint32_t n = std::min<uint32_t>(take - done, 48);   // 48 bytes → 64 chars
+            const size_t len = StreamEx_utility::base64Encode(block, sizeof(block), data + done, n);
+            if (_txPool) _txChunks.append(*_txPool, block, (uint32_t)len, _txQuota);
+            else _txBip.append(block, (uint32_t)len);
+            done += n;
+        }
+        _txPosition = _txPool ? _txChunks.size : _txBip.size();
+        _watchTx();
+        return take;
+    }
+
+    _txPosition += (uint32_t)StreamEx_utility::base64Encode(_txBuffer + _txPosition, freeCap + 1, data, take);
+    _watchTx();
+    return take;
+}
+
+uint32_t StreamEx::popFrontRxHex(uint8_t* data, uint32_t maxSize)
+{
+    if (!data) { errorCode = StreamExError::NullData; return 0; }
+    _syncRx();
+    if (!_rxLinear()) {
+        // Segmented/bip/ring: decode through a small stack block so pairs split across chunks or the wrap work.
+        char block[64];
+        uint32_t done = 0;
+        while (done < maxSize) {
+            const uint32_t chars = std::min<uint32_t>(std::min<uint32_t>(_rxPosition / 2, maxSize - done), sizeof(block) / 2) * 2;
+            if (chars == 0) break;
+            _peekRx(block, chars);
+            size_t w = 0;
+            StreamEx_utility::hexDecode(data + done, maxSize - done, block, chars, &w);
+            _dropFrontRx((uint32_t)(2 * w));
+            done += (uint32_t)w;
+            if (2 * w < chars) break;   // non-hex character stays in RX
+        }
+        return done;
+    }
+    if (!_rxBuffer) return 0;
+
+    size_t n = 0;
+    StreamEx_utility::hexDecode(data, maxSize, _rxBuffer, std::min<uint32_t>(_rxPosition / 2, maxSize) * 2, &n);
+    _dropFrontRx((uint32_t)(2 * n));
+    return (uint32_t)n;
+}
+
+uint32_t StreamEx::popFrontRxBase64(uint8_t* data, uint32_t maxSize)
+{
+    if (!data) { errorCode = StreamExError::NullData; return 0; }
+    _syncRx();
+    if (!_rxLinear()) {
+        char block[64];
+        uint32_t done = 0;
+        for (;;) {
+            const uint32_t q = std::min<uint32_t>(std::min<uint32_t>(_rxPosition / 4, (maxSize - done + 2) / 3), sizeof(block) / 4);
+            if (q == 0) break;
+            _peekRx(block, q * 4);
+            size_t w = 0;
+            StreamEx_utility::base64Decode(data + done, maxSize - done, block, q * 4, &w);
+            const uint32_t consumed = (uint32_t)(((w + 2) / 3) * 4);
+            _dropFrontRx(consumed);
+            done += (uint32_t)w;
+            if (consumed < q * 4 || w % 3) break;   // padding, invalid character or full output
+        }
+        return done;
+    }
+    if (!_rxBuffer) return 0;
+
+    // Decode every complete quantum that fits; a failed quantum stays in RX.
+    const uint32_t quanta = std::min<uint32_t>(_rxPosition / 4, (maxSize + 2) / 3);
+    size_t n = 0;
+    StreamEx_utility::base64Decode(data, maxSize, _rxBuffer, quanta * 4, &n);
+    // Characters consumed: every full quantum, plus one for a padded final quantum.
+    const uint32_t consumed = (uint32_t)(((n + 2) / 3) * 4);
+    _dropFrontRx(consumed);
+    return (uint32_t)n;
+}
+
 // ----------------------------------------------
 
 bool StreamEx::removeFrontTxBuffer(uint32_t dataSize)
 {
+    _txReserved = 0;
     if (dataSize > _txPosition) { errorCode = StreamExError::NotEnoughData; return false; }
 
+    if (!_txLinear() || _txMirror) { _dropFrontTx(dataSize); return true; }
+
     // Shift the remaining data in the TX buffer
     memmove(_txBuffer, _txBuffer + dataSize, _txPosition - dataSize);
 
@@ -603,22 +1920,29 @@ bool StreamEx::removeFrontTxBuffer(uint32_t dataSize)
 
     // Null-terminate the remaining buffer (optional for string usage)
     _txBuffer[_txPosition] = '\0';
+    _watchTx();
 
     return true;
 }
 
 bool StreamEx::removeFrontRxBuffer(uint32_t dataSize)
 {
+    _rxReserved = 0;
+    _syncRx();
     if (dataSize > _rxPosition) { errorCode = StreamExError::NotEnoughData; return false; }
 
+    if (!_rxLinear() || _rxMirror) { _dropFrontRx(dataSize); return true; }
+
     // Shift the remaining data in the TX buffer
     memmove(_rxBuffer, _rxBuffer + dataSize, _rxPosition - dataSize);
 
     // Update the TX buffer position
     _rxPosition -= dataSize;
+    _consumedRx(dataSize);
 
     // Null-terminate the remaining buffer (optional for string usage)
     _rxBuffer[_rxPosition] = '\0';
+    _watchRx();
 
     return true;
 }
@@ -626,19 +1950,22 @@ bool StreamEx::removeFrontRxBuffer(uint32_t dataSize)
 // ---------------- Arduino-like interface (no Stream inheritance) ----------------
 
 int StreamEx::available() {
+    _syncRx();
     return (int)_rxPosition;
 }
 
 int StreamEx::read() {
-    if (_rxPosition == 0 || !_rxBuffer) return -1;
-    uint8_t b = (uint8_t)_rxBuffer[0];
+    _syncRx();
+    if (_rxPosition == 0 || !getRxBuffer()) return -1;
+    uint8_t b = (uint8_t)getRxBuffer()[0];
     _dropFrontRx(1);
     return (int)b;
 }
 
 int StreamEx::peek() {
-    if (_rxPosition == 0 || !_rxBuffer) return -1;
-    return (uint8_t)_rxBuffer[0];
+    _syncRx();
+    if (_rxPosition == 0 || !getRxBuffer()) return -1;
+    return (uint8_t)getRxBuffer()[0];
 }
 
 void StreamEx::flush() {
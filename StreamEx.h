@@ -19,6 +19,10 @@
 #include <Arduino.h>      ///< Arduino core (Print/Stream base, String type, millis, etc.)
 #include <stdint.h>       ///< Fixed-width integer types
 #include <stddef.h>       ///< size_t, nullptr_t
+#include <string.h>       ///< memcpy (inline accessors)
+
+#include "StreamExChunkPool.h"
+#include "StreamExBipBuffer.h"
 
 /**
  * @def STREAMEX_ENABLE_STD_STRING
@@ -59,6 +63,17 @@
   #define STREAMEX_STRING_CAP 32  ///< Capacity for dataValueUnion::stringValue (includes '\0')
 #endif
 
+/**
+ * @def STREAMEX_CONSTEXPR14
+ * @brief Expands to `constexpr` when the compiler supports C++14 relaxed constexpr
+ *        (needed for functions that write through an output pointer), else nothing.
+ */
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+  #define STREAMEX_CONSTEXPR14 constexpr
+#else
+  #define STREAMEX_CONSTEXPR14
+#endif
+
 /**
  * @enum dataTypeEnum
  * @brief Enumeration of supported scalar/string/boolean value kinds for parsing/formatting.
@@ -78,7 +93,9 @@ enum dataTypeEnum
     doubleType, ///< 64-bit double
     charType,   ///< Single character
     stringType, ///< C-string (NUL-terminated)
-    boolType    ///< Boolean (true/false or 0/1)
+    boolType,   ///< Boolean (true/false or 0/1)
+    q16_16Type, ///< Signed Q16.16 fixed point (int32_t raw, 16 fractional bits)
+    q8_24Type   ///< Signed Q8.24 fixed point (int32_t raw, 24 fractional bits)
 };
 
 /**
@@ -97,6 +114,8 @@ enum dataTypeEnum
  * @var dataValueUnion::doubleValue 64-bit double value
  * @var dataValueUnion::stringValue Small inline string buffer (capacity = STREAMEX_STRING_CAP)
  * @var dataValueUnion::boolValue   Boolean value
+ * @var dataValueUnion::q16_16Value Q16.16 fixed-point raw value (value × 2^16)
+ * @var dataValueUnion::q8_24Value  Q8.24 fixed-point raw value (value × 2^24)
  *
  * @note `stringValue` is intended as a scratch/output buffer for small strings.
  *       For larger strings, pass an external buffer to the converters.
@@ -115,6 +134,127 @@ union dataValueUnion
     double   doubleValue;
     char     stringValue[STREAMEX_STRING_CAP];
     bool     boolValue;
+    int32_t  q16_16Value;
+    int32_t  q8_24Value;
+};
+
+/**
+ * @def STREAMEX_VALUE_SSO_CAP
+ * @brief Inline string capacity (bytes, no terminator) of ::dataValue.
+ *
+ * @note Fixed by the 12-byte payload of ::dataValue; strings longer than this are
+ *       stored as views into caller memory.
+ */
+#define STREAMEX_VALUE_SSO_CAP 12
+
+/**
+ * @class dataValue
+ * @brief Compact tagged value (16 bytes; 14 on AVR) carrying its own ::dataTypeEnum.
+ *
+ * @details
+ * Numbers and booleans are stored inline. Strings are either a **view** (pointer +
+ * length into caller memory; no copy, caller keeps the memory alive) or a
+ * small-string-optimized **inline** copy of up to ::STREAMEX_VALUE_SSO_CAP bytes.
+ * String payloads are not NUL-terminated; use `stringData()` with `stringSize()`.
+ *
+ * Use this instead of ::dataValueUnion for arrays of parsed values; convert with
+ * `fromUnion()` / `toUnion()` where the legacy API is needed.
+ */
+class dataValue
+{
+  public:
+
+    /** @brief Construct an empty value (::noneType). */
+    dataValue() : _type(noneType), _inline(0) { memset(_raw, 0, sizeof(_raw)); }
+
+    /** @brief Value type. */
+    dataTypeEnum type() const { return (dataTypeEnum)_type; }
+
+    /**
+     * @brief Load from a legacy union.
+     * @param value Source union.
+     * @param type  Type held in @p value.
+     *
+     * @note ::stringType is copied inline when it fits, otherwise stored as a view of
+     *       `value.stringValue` (so @p value must outlive this object).
+     */
+    void fromUnion(const dataValueUnion& value, dataTypeEnum type);
+
+    /**
+     * @brief Store into a legacy union.
+     * @param value Destination union (must be non-null).
+     * @param type  Optional destination for the type tag.
+     * @return false for ::noneType or null @p value.
+     *
+     * @note Strings are truncated to `STREAMEX_STRING_CAP - 1` characters.
+     */
+    bool toUnion(dataValueUnion* value, dataTypeEnum* type = nullptr) const;
+
+    /**
+     * @brief Make this a string view over caller memory (no copy).
+     * @param str  Pointer to characters (need not be NUL-terminated).
+     * @param size Number of characters.
+     */
+    void setView(const char* str, uint32_t size)
+    {
+        _type = stringType; _inline = 0;
+        memcpy(_raw, &str, sizeof(str));
+        _raw[2] = size;
+    }
+
+    /**
+     * @brief Copy a short string inline.
+     * @param str  Source characters.
+     * @param size Number of characters (≤ ::STREAMEX_VALUE_SSO_CAP).
+     * @retval false Too long; value unchanged.
+     */
+    bool setString(const char* str, uint32_t size)
+    {
+        if (size > STREAMEX_VALUE_SSO_CAP || (!str && size)) return false;
+        _type = stringType; _inline = (uint8_t)(size + 1);
+        if (size) memcpy(_raw, str, size);
+        return true;
+    }
+
+    /** @brief true if the string payload points into caller memory. */
+    bool isView() const { return _type == stringType && _inline == 0; }
+
+    /** @brief String characters (not NUL-terminated); nullptr if not ::stringType. */
+    const char* stringData() const
+    {
+        if (_type != stringType) return nullptr;
+        if (_inline) return reinterpret_cast<const char*>(_raw);
+        const char* p; memcpy(&p, _raw, sizeof(p)); return p;
+    }
+
+    /** @brief String length in bytes; 0 if not ::stringType. */
+    uint32_t stringSize() const
+    {
+        if (_type != stringType) return 0;
+        return _inline ? (uint32_t)(_inline - 1) : _raw[2];
+    }
+
+    // ----- Typed accessors (caller must check type()) -----
+    uint8_t  asUint8 () const { return _load<uint8_t >(); }
+    uint16_t asUint16() const { return _load<uint16_t>(); }
+    uint32_t asUint32() const { return _load<uint32_t>(); }
+    uint64_t asUint64() const { return _load<uint64_t>(); }
+    int8_t   asInt8  () const { return _load<int8_t  >(); }
+    int16_t  asInt16 () const { return _load<int16_t >(); }
+    int32_t  asInt32 () const { return _load<int32_t >(); }
+    int64_t  asInt64 () const { return _load<int64_t >(); }
+    float    asFloat () const { return _load<float   >(); }
+    double   asDouble() const { return _load<double  >(); }
+    bool     asBool  () const { return _load<bool    >(); }
+    char     asChar  () const { return _load<char    >(); }
+
+  private:
+
+    uint32_t _raw[3];   ///< Payload: scalar bits, view pointer + length, or inline characters.
+    uint8_t  _type;     ///< ::dataTypeEnum tag.
+    uint8_t  _inline;   ///< For strings: inline length + 1, or 0 for a view.
+
+    template <typename T> T _load() const { T v; memcpy(&v, _raw, sizeof(T)); return v; }
 };
 
 /**
@@ -138,11 +278,35 @@ size_t safe_strnlen(const char* str, size_t maxlen);
  */
 char tolow(char c);
 
+/**
+ * @brief ASCII-only tolower (locale independent, usable in constant expressions).
+ * @param c Input character.
+ * @return Lowercased character for 'A'..'Z'; @p c unchanged otherwise.
+ */
+constexpr char asciiLower(char c) { return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c; }
+
+/**
+ * @brief Case-insensitive (ASCII) equality usable in constant expressions.
+ * @param a First C-string (must be non-null).
+ * @param b Second C-string (must be non-null).
+ * @return true if equal ignoring ASCII case.
+ *
+ * @note Recurses once per character: meant for literals (::constBool). Use ::iequal at
+ *       runtime (word-at-a-time, no recursion).
+ */
+constexpr bool iequalConst(const char* a, const char* b)
+{
+    return (*a == '\0' || *b == '\0') ? (*a == *b)
+         : (asciiLower(*a) == asciiLower(*b) && iequalConst(a + 1, b + 1));
+}
+
 /**
  * @brief Case-insensitive equality for ASCII tokens.
  * @param a First C-string (nullable → false).
  * @param b Second C-string (nullable → false).
  * @return true if equal ignoring case; else false.
+ *
+ * @note ASCII-only folding; compares via ::iequalN (word-at-a-time).
  */
 bool iequal(const char* a, const char* b);
 
@@ -153,19 +317,86 @@ bool iequal(const char* a, const char* b);
  */
 bool isNumber(const char* s);
 
+// ----- constexpr building blocks -----
+// The recursive single-return forms (C++11) recurse once per character, so only the
+// compile-time converters (::constUint8 … ::constBool) use them, on literals. Anything
+// that may see untrusted input loops instead.
+
+/** @brief true for '0'..'9'. */
+constexpr bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+/** @brief Skip one leading '+' or '-'. */
+constexpr const char* skipSign(const char* s) { return (*s == '+' || *s == '-') ? s + 1 : s; }
+
+/** @brief true if every character up to NUL is a digit (true for ""; recursive, literals only). */
+constexpr bool allDigits(const char* p) { return *p == '\0' || (isDigit(*p) && allDigits(p + 1)); }
+
+/**
+ * @brief true if the digits at @p p (up to NUL) form a value ≤ @p maxValue (recursive, literals only).
+ * @param p        Digit string (already validated by ::allDigits).
+ * @param maxValue Largest accepted value.
+ * @param acc      Accumulator (leave at 0).
+ */
+constexpr bool digitsFit(const char* p, uint64_t maxValue, uint64_t acc = 0)
+{
+    return *p == '\0' ||
+           (acc <= (maxValue - (uint8_t)(*p - '0')) / 10 &&
+            digitsFit(p + 1, maxValue, acc * 10 + (uint8_t)(*p - '0')));
+}
+
+/** @brief Value of the digit string at @p p (no validation; see ::digitsFit; recursive, literals only). */
+constexpr uint64_t digitsValue(const char* p, uint64_t acc = 0)
+{
+    return *p == '\0' ? acc : digitsValue(p + 1, acc * 10 + (uint8_t)(*p - '0'));
+}
+
+/**
+ * @brief Value of the digit string at @p p if it is ≤ @p maxValue (iterative).
+ * @param p        Digit string (already validated, e.g. by ::isInteger).
+ * @param maxValue Largest accepted value.
+ * @param out      Receives the value on success.
+ * @return false on overflow past @p maxValue.
+ */
+STREAMEX_CONSTEXPR14 inline bool digitsTo(const char* p, uint64_t maxValue, uint64_t* out)
+{
+    uint64_t v = 0;
+    for (; *p; ++p)
+    {
+        const uint8_t d = (uint8_t)(*p - '0');
+        if (v > (maxValue - d) / 10) return false;
+        v = v * 10 + d;
+    }
+    *out = v;
+    return true;
+}
+
 /**
  * @brief Test if string is an integer of the form [+|-]?digits+.
  * @param s C-string.
  * @return true if integer; false otherwise.
+ *
+ * @note constexpr with C++14 or later: constant strings can be validated at compile time.
  */
-bool isInteger(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isInteger(const char* s)
+{
+    if (!s) return false;
+    s = skipSign(s);
+    if (*s == '\0') return false;
+    for (; *s; ++s) if (!isDigit(*s)) return false;
+    return true;
+}
 
 /**
  * @brief Test if string is an unsigned integer of the form [+]?digits+.
  * @param s C-string.
  * @return true if unsigned integer; false otherwise.
+ *
+ * @note constexpr with C++14 or later.
  */
-bool isUInteger(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isUInteger(const char* s)
+{
+    return s != nullptr && *s != '-' && isInteger(s);
+}
 
 /**
  * @brief Trim ASCII spaces from both ends of a C-string in place.
@@ -196,25 +427,30 @@ bool isWhitespaceOnly(const char* data);
  */
 bool validateRow(const char* data, size_t expectedColumnCount);
 
-// --- Typed validators ---
+// --- Typed validators (constexpr with C++14 or later) ---
+
+/** @brief Validate unsigned integer text ≤ @p maxValue. */
+STREAMEX_CONSTEXPR14 inline bool isUIntMax(const char* s, uint64_t maxValue) { uint64_t v = 0; return isUInteger(s) && digitsTo(skipSign(s), maxValue, &v); }
+/** @brief Validate signed integer text within [-(@p maxValue + 1), @p maxValue]. */
+STREAMEX_CONSTEXPR14 inline bool isIntMax (const char* s, uint64_t maxValue) { uint64_t v = 0; return isInteger(s) && digitsTo(skipSign(s), (*s == '-') ? maxValue + 1 : maxValue, &v); }
 
 /** @brief Validate 0..255 range. */
-bool isUInt8 (const char* s);
+STREAMEX_CONSTEXPR14 inline bool isUInt8 (const char* s) { return isUIntMax(s, UINT8_MAX); }
 /** @brief Validate 0..65535 range. */
-bool isUInt16(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isUInt16(const char* s) { return isUIntMax(s, UINT16_MAX); }
 /** @brief Validate 32-bit unsigned integer. */
-bool isUInt32(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isUInt32(const char* s) { return isUIntMax(s, UINT32_MAX); }
 /** @brief Validate 64-bit unsigned integer. */
-bool isUInt64(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isUInt64(const char* s) { return isUIntMax(s, UINT64_MAX); }
 
 /** @brief Validate −128..127 range. */
-bool isInt8 (const char* s);
+STREAMEX_CONSTEXPR14 inline bool isInt8 (const char* s) { return isIntMax(s, INT8_MAX); }
 /** @brief Validate −32768..32767 range. */
-bool isInt16(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isInt16(const char* s) { return isIntMax(s, INT16_MAX); }
 /** @brief Validate 32-bit signed integer. */
-bool isInt32(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isInt32(const char* s) { return isIntMax(s, INT32_MAX); }
 /** @brief Validate 64-bit signed integer. */
-bool isInt64(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isInt64(const char* s) { return isIntMax(s, INT64_MAX); }
 
 /** @brief Validate float grammar/value. */
 bool isFloat (const char* s);
@@ -225,19 +461,80 @@ bool isDouble(const char* s);
  * @brief Validate boolean (accepts "true"/"false" any case or "0"/"1").
  * @param s C-string.
  * @return true if boolean token; else false.
+ *
+ * @note constexpr with C++14 or later.
  */
-bool isBoolean(const char* s);
+STREAMEX_CONSTEXPR14 inline bool isBoolean(const char* s)
+{
+    if (!s) return false;
+    if ((s[0] == '0' || s[0] == '1') && s[1] == '\0') return true;
+    const char* word = (asciiLower(s[0]) == 't') ? "true" : "false";
+    for (; *word; ++s, ++word) if (asciiLower(*s) != *word) return false;
+    return *s == '\0';
+}
+
+/** @brief Value of a validated unsigned integer string. */
+STREAMEX_CONSTEXPR14 inline uint64_t uintValue(const char* s)
+{
+    uint64_t v = 0;
+    for (s = skipSign(s); *s; ++s) v = v * 10 + (uint8_t)(*s - '0');
+    return v;
+}
+/** @brief Value of a validated signed integer string (two's complement negate; INT64_MIN safe). */
+STREAMEX_CONSTEXPR14 inline int64_t intValue(const char* s) { return (*s == '-') ? (int64_t)(0 - uintValue(s)) : (int64_t)uintValue(s); }
 
 // ----- Converters (return false on parse/range error) -----
-bool stringToUint8 (const char* s, uint8_t*  out);
-bool stringToUint16(const char* s, uint16_t* out);
-bool stringToUint32(const char* s, uint32_t* out);
-bool stringToUint64(const char* s, uint64_t* out);
+// Integer converters accept exactly the text their validator accepts. They are
+// constexpr when compiled as C++14 or later (writing through @p out needs it).
 
-bool stringToInt8 (const char* s, int8_t*  out);
-bool stringToInt16(const char* s, int16_t* out);
-bool stringToInt32(const char* s, int32_t* out);
-bool stringToInt64(const char* s, int64_t* out);
+STREAMEX_CONSTEXPR14 inline bool stringToUint8 (const char* s, uint8_t*  out){ if(!out || !isUInt8 (s)) return false; *out=(uint8_t) uintValue(s); return true; }
+STREAMEX_CONSTEXPR14 inline bool stringToUint16(const char* s, uint16_t* out){ if(!out || !isUInt16(s)) return false; *out=(uint16_t)uintValue(s); return true; }
+STREAMEX_CONSTEXPR14 inline bool stringToUint32(const char* s, uint32_t* out){ if(!out || !isUInt32(s)) return false; *out=(uint32_t)uintValue(s); return true; }
+STREAMEX_CONSTEXPR14 inline bool stringToUint64(const char* s, uint64_t* out){ if(!out || !isUInt64(s)) return false; *out=(uint64_t)uintValue(s); return true; }
+
+STREAMEX_CONSTEXPR14 inline bool stringToInt8 (const char* s, int8_t*  out){ if(!out || !isInt8 (s)) return false; *out=(int8_t) intValue(s); return true; }
+STREAMEX_CONSTEXPR14 inline bool stringToInt16(const char* s, int16_t* out){ if(!out || !isInt16(s)) return false; *out=(int16_t)intValue(s); return true; }
+STREAMEX_CONSTEXPR14 inline bool stringToInt32(const char* s, int32_t* out){ if(!out || !isInt32(s)) return false; *out=(int32_t)intValue(s); return true; }
+STREAMEX_CONSTEXPR14 inline bool stringToInt64(const char* s, int64_t* out){ if(!out || !isInt64(s)) return false; *out=(int64_t)intValue(s); return true; }
+
+/**
+ * @brief Reached only when a `constUint8()`…`constBool()` argument is invalid.
+ * @note Deliberately not constexpr: evaluating it in a constant expression is a compile
+ *       error, which is how invalid constant strings are rejected. Returns 0 at runtime.
+ */
+int constantParseError();
+
+// ----- Constant converters (C++11 constexpr; invalid text fails to compile) -----
+// Literal-only checks in the recursive single-return form, so they also work in C++11.
+
+/** @brief Literal is [+]?digits+ with a value ≤ @p maxValue (recursive, literals only). */
+constexpr bool literalIsUInt(const char* s, uint64_t maxValue)
+{
+    return *s != '-' && *skipSign(s) != '\0' && allDigits(skipSign(s)) && digitsFit(skipSign(s), maxValue);
+}
+/** @brief Literal is [+|-]?digits+ within [-(@p maxValue + 1), @p maxValue] (recursive, literals only). */
+constexpr bool literalIsInt(const char* s, uint64_t maxValue)
+{
+    return *skipSign(s) != '\0' && allDigits(skipSign(s)) && digitsFit(skipSign(s), (*s == '-') ? maxValue + 1 : maxValue);
+}
+/** @brief Value of a signed literal validated by ::literalIsInt. */
+constexpr int64_t literalInt(const char* s) { return (*s == '-') ? (int64_t)(0 - digitsValue(s + 1)) : (int64_t)digitsValue(skipSign(s)); }
+/** @brief Literal is a boolean token (see ::isBoolean; recursive, literals only). */
+constexpr bool literalIsBool(const char* s)
+{
+    return ((s[0] == '0' || s[0] == '1') && s[1] == '\0') || iequalConst(s, "true") || iequalConst(s, "false");
+}
+
+/** @code constexpr uint16_t kPort = StreamEx_utility::constUint16("8080"); @endcode */
+constexpr uint8_t  constUint8 (const char* s) { return literalIsUInt(s, UINT8_MAX)  ? (uint8_t) digitsValue(skipSign(s)) : (uint8_t) constantParseError(); }
+constexpr uint16_t constUint16(const char* s) { return literalIsUInt(s, UINT16_MAX) ? (uint16_t)digitsValue(skipSign(s)) : (uint16_t)constantParseError(); }
+constexpr uint32_t constUint32(const char* s) { return literalIsUInt(s, UINT32_MAX) ? (uint32_t)digitsValue(skipSign(s)) : (uint32_t)constantParseError(); }
+constexpr uint64_t constUint64(const char* s) { return literalIsUInt(s, UINT64_MAX) ? (uint64_t)digitsValue(skipSign(s)) : (uint64_t)constantParseError(); }
+constexpr int8_t   constInt8  (const char* s) { return literalIsInt(s, INT8_MAX)    ? (int8_t)  literalInt(s) : (int8_t)  constantParseError(); }
+constexpr int16_t  constInt16 (const char* s) { return literalIsInt(s, INT16_MAX)   ? (int16_t) literalInt(s) : (int16_t) constantParseError(); }
+constexpr int32_t  constInt32 (const char* s) { return literalIsInt(s, INT32_MAX)   ? (int32_t) literalInt(s) : (int32_t) constantParseError(); }
+constexpr int64_t  constInt64 (const char* s) { return literalIsInt(s, INT64_MAX)   ? (int64_t) literalInt(s) : (int64_t) constantParseError(); }
+constexpr bool     constBool  (const char* s) { return literalIsBool(s) ? (s[0] == '1' || asciiLower(s[0]) == 't') : (constantParseError() != 0); }
 
 bool stringToFloat (const char* s, float*  out);
 bool stringToDouble(const char* s, double* out);
@@ -270,6 +567,467 @@ bool stringToNumber(const char* str, dataValueUnion* num, dataTypeEnum type);
  */
 void dataValueToString(char *out, size_t outCap, const dataValueUnion& value, dataTypeEnum type);
 
+/**
+ * @brief Storage size in bytes of a value of @p type (as held in ::dataValueUnion).
+ * @param type Data type.
+ * @return Size in bytes; `STREAMEX_STRING_CAP` for ::stringType, 0 for ::noneType/unknown.
+ */
+size_t dataTypeSize(dataTypeEnum type);
+
+// ----- Span helpers (pointer + length; no NUL terminator required) -----
+
+/**
+ * @brief One FNV-1a step over the remaining characters of @p s (ASCII case folded).
+ * @note Implementation detail of ::ihash; prefer calling ::ihash directly.
+ */
+constexpr uint32_t ihashStep(const char* s, uint32_t h)
+{
+    return (*s == '\0') ? h : ihashStep(s + 1, (h ^ (uint8_t)asciiLower(*s)) * 16777619UL);
+}
+
+/**
+ * @brief Case-insensitive 32-bit FNV-1a hash of a C-string.
+ * @param s NUL-terminated key (must be non-null).
+ * @return Hash value; identical to `ihashN(s, strlen(s))`.
+ *
+ * @note constexpr: keys written as literals are hashed at compile time.
+ */
+constexpr uint32_t ihash(const char* s) { return ihashStep(s, 2166136261UL); }
+
+/**
+ * @brief ASCII lowercase @p n bytes from @p src into @p dst (may alias).
+ * @param dst Destination (nullable → no-op).
+ * @param src Source (nullable → no-op).
+ * @param n   Number of bytes.
+ *
+ * @note Folds 16 bytes per step with SSE2, otherwise a machine word per step (SWAR);
+ *       8-bit AVR uses the byte loop.
+ */
+void asciiLowerN(char* dst, const char* src, size_t n);
+
+/**
+ * @brief Case-insensitive 32-bit FNV-1a hash of @p n bytes (runtime counterpart of ::ihash).
+ * @param s Pointer to bytes (nullable when @p n is 0).
+ * @param n Number of bytes to hash.
+ * @return Hash value; equal for inputs that compare equal with ::iequalN.
+ */
+uint32_t ihashN(const char* s, size_t n);
+
+/**
+ * @brief Case-insensitive (ASCII) equality of two byte ranges of the same length.
+ * @param a First range (nullable → false).
+ * @param b Second range (nullable → false).
+ * @param n Number of bytes to compare.
+ * @return true if all @p n bytes match ignoring ASCII case.
+ *
+ * @note Word-at-a-time like ::asciiLowerN; identical words skip folding entirely.
+ */
+bool iequalN(const char* a, const char* b, size_t n);
+
+/**
+ * @brief Validate and parse a byte range (not necessarily NUL-terminated) to a typed value.
+ * @param str  Pointer to the first character.
+ * @param len  Number of characters in the value.
+ * @param num  Output union to fill on success.
+ * @param type Desired type.
+ * @return true on success; false if the text is not a valid @p type value.
+ *
+ * @details Unlike the C-string overload, validation and conversion are done in one pass
+ *          and booleans are strict ("true"/"false" any case or "0"/"1"). Integers are
+ *          parsed in place; float/double are copied to a small stack buffer for `strtod`.
+ *          ::stringType is truncated to `STREAMEX_STRING_CAP - 1` characters.
+ */
+bool stringToNumber(const char* str, uint32_t len, dataValueUnion* num, dataTypeEnum type);
+
+/**
+ * @brief Validate and parse a byte range into a compact ::dataValue.
+ * @param str  Pointer to the first character.
+ * @param len  Number of characters.
+ * @param out  Destination value.
+ * @param type Desired type.
+ * @return true on success.
+ *
+ * @note ::stringType becomes a view into @p str (no copy).
+ */
+bool stringToValue(const char* str, uint32_t len, dataValue* out, dataTypeEnum type);
+
+/**
+ * @brief Parse one comma-separated row into typed values.
+ * @param data        Row characters (not necessarily NUL-terminated).
+ * @param len         Number of characters in @p data.
+ * @param types       Expected type of each column.
+ * @param out         Destination array of @p columnCount values.
+ * @param columnCount Number of columns expected.
+ * @return true if the row has exactly @p columnCount fields and all parse.
+ *
+ * @details Fields are trimmed of spaces/tabs. String columns are views into @p data.
+ */
+bool parseRow(const char* data, uint32_t len, const dataTypeEnum* types, dataValue* out, size_t columnCount);
+
+// ----- Statically typed parse/format (no per-value type switch) -----
+
+/**
+ * @brief Parse `[+]?digits+` into an unsigned integer, accumulating in @p U.
+ * @param s        Characters (not necessarily NUL-terminated).
+ * @param n        Number of characters.
+ * @param maxValue Largest accepted value.
+ * @param out      Destination (written only on success).
+ * @return false on syntax error or value > @p maxValue.
+ */
+template <typename U>
+inline bool parseUnsigned(const char* s, uint32_t n, U maxValue, U* out)
+{
+    uint32_t i = 0;
+    if (i < n && s[i] == '+') ++i;
+    if (i == n) return false;
+    U v = 0;
+    for (; i < n; ++i)
+    {
+        const uint8_t d = (uint8_t)(s[i] - '0');
+        if (d > 9) return false;
+        if (v > (U)(maxValue - d) / 10) return false;
+        v = (U)(v * 10 + d);
+    }
+    *out = v;
+    return true;
+}
+
+/**
+ * @brief Parse `[+|-]?digits+` into a signed integer @p S (magnitude accumulated in @p U).
+ * @param s        Characters (not necessarily NUL-terminated).
+ * @param n        Number of characters.
+ * @param minValue Smallest accepted value.
+ * @param maxValue Largest accepted value.
+ * @param out      Destination (written only on success).
+ * @return false on syntax error or out-of-range value.
+ */
+template <typename S, typename U>
+inline bool parseSigned(const char* s, uint32_t n, S minValue, S maxValue, S* out)
+{
+    bool neg = false;
+    uint32_t i = 0;
+    if (i < n && (s[i] == '+' || s[i] == '-')) { neg = (s[i] == '-'); ++i; }
+    if (i == n) return false;
+    const U limit = neg ? (U)((U)0 - (U)minValue) : (U)maxValue;
+    U mag = 0;
+    if (!parseUnsigned<U>(s + i, n - i, limit, &mag)) return false;
+    *out = neg ? (S)((U)0 - mag) : (S)mag;
+    return true;
+}
+
+/** @brief Parse a float from a byte range (copies ≤39 chars to the stack for `strtof`). */
+bool parseFloat (const char* s, uint32_t n, float*  out);
+/** @brief Parse a double from a byte range (copies ≤39 chars to the stack for `strtod`). */
+bool parseDouble(const char* s, uint32_t n, double* out);
+
+/**
+ * @brief Copy @p n characters into @p out with truncation and NUL termination.
+ * @return @p n (the untruncated length, like `snprintf`).
+ */
+inline size_t formatChars(char* out, size_t outCap, const char* src, size_t n)
+{
+    if (!out || outCap == 0) return n;
+    const size_t k = (n < outCap) ? n : (outCap - 1);
+    memcpy(out, src, k);
+    out[k] = '\0';
+    return n;
+}
+
+/**
+ * @brief Format an unsigned integer in base 10 (optionally with a leading '-').
+ * @return Number of characters of the full result (excluding NUL), like `snprintf`.
+ */
+template <typename U>
+inline size_t formatUnsigned(char* out, size_t outCap, U v, bool negative = false)
+{
+    char tmp[21];
+    char* p = tmp + sizeof(tmp);
+    do { *--p = (char)('0' + (uint8_t)(v % 10)); v = (U)(v / 10); } while (v);
+    if (negative) *--p = '-';
+    return formatChars(out, outCap, p, (size_t)(tmp + sizeof(tmp) - p));
+}
+
+/** @brief Format a signed integer @p S in base 10 via its unsigned magnitude @p U. */
+template <typename S, typename U>
+inline size_t formatSigned(char* out, size_t outCap, S v)
+{
+    return (v < 0) ? formatUnsigned<U>(out, outCap, (U)((U)0 - (U)v), true)
+                   : formatUnsigned<U>(out, outCap, (U)v);
+}
+
+/** @brief Format a double with `%g` (shared by float/double). */
+size_t formatDouble(char* out, size_t outCap, double v);
+
+// ----- Fixed point (integer arithmetic only; no float/libm) -----
+
+/** @brief Fractional bits of ::q16_16Type. */
+#define STREAMEX_Q16_16_FRAC_BITS 16
+/** @brief Fractional bits of ::q8_24Type. */
+#define STREAMEX_Q8_24_FRAC_BITS  24
+
+/**
+ * @brief Parse decimal text `[+|-]?digits[.digits]` into signed fixed point.
+ * @param s        Characters (not necessarily NUL-terminated).
+ * @param n        Number of characters.
+ * @param fracBits Fractional bits of the target format (1..30).
+ * @param out      Raw result (value × 2^fracBits), rounded to nearest.
+ * @return false on syntax error or when the value does not fit in int32_t.
+ *
+ * @note Up to 9 fractional digits are significant; further digits are validated and ignored.
+ */
+bool parseFixed(const char* s, uint32_t n, uint8_t fracBits, int32_t* out);
+
+/**
+ * @brief Format signed fixed point as decimal text.
+ * @param out      Destination (always NUL-terminated when @p outCap > 0).
+ * @param outCap   Capacity of @p out.
+ * @param value    Raw fixed-point value.
+ * @param fracBits Fractional bits of @p value's format (1..30).
+ * @param decimals Maximum fractional digits (0..9); rounded, trailing zeros trimmed.
+ * @return Length of the full text (excluding NUL), like `snprintf`.
+ */
+size_t formatFixed(char* out, size_t outCap, int32_t value, uint8_t fracBits, uint8_t decimals);
+
+/** @brief Validate Q16.16 text (range −32768 .. 32767.99998). */
+bool isQ16_16(const char* s);
+/** @brief Validate Q8.24 text (range −128 .. 127.99999994). */
+bool isQ8_24 (const char* s);
+
+/** @brief Parse a C-string as Q16.16 raw value. */
+bool stringToQ16_16(const char* s, int32_t* out);
+/** @brief Parse a C-string as Q8.24 raw value. */
+bool stringToQ8_24 (const char* s, int32_t* out);
+
+/**
+ * @brief Parse a byte range as @p T, selected at compile time.
+ * @tparam T One of uint8_t..uint64_t, int8_t..int64_t, float, double, bool, char.
+ * @param str Characters (not necessarily NUL-terminated).
+ * @param len Number of characters.
+ * @param out Destination (written only on success).
+ * @return true on success. Booleans accept "true"/"false" (any case) or "0"/"1".
+ */
+template <typename T> bool parse(const char* str, uint32_t len, T* out);
+
+template <> inline bool parse<uint8_t >(const char* s, uint32_t n, uint8_t*  o) { return parseUnsigned<uint8_t >(s, n, UINT8_MAX,  o); }
+template <> inline bool parse<uint16_t>(const char* s, uint32_t n, uint16_t* o) { return parseUnsigned<uint16_t>(s, n, UINT16_MAX, o); }
+template <> inline bool parse<uint32_t>(const char* s, uint32_t n, uint32_t* o) { return parseUnsigned<uint32_t>(s, n, UINT32_MAX, o); }
+template <> inline bool parse<uint64_t>(const char* s, uint32_t n, uint64_t* o) { return parseUnsigned<uint64_t>(s, n, UINT64_MAX, o); }
+template <> inline bool parse<int8_t  >(const char* s, uint32_t n, int8_t*   o) { return parseSigned<int8_t,  uint8_t >(s, n, INT8_MIN,  INT8_MAX,  o); }
+template <> inline bool parse<int16_t >(const char* s, uint32_t n, int16_t*  o) { return parseSigned<int16_t, uint16_t>(s, n, INT16_MIN, INT16_MAX, o); }
+template <> inline bool parse<int32_t >(const char* s, uint32_t n, int32_t*  o) { return parseSigned<int32_t, uint32_t>(s, n, INT32_MIN, INT32_MAX, o); }
+template <> inline bool parse<int64_t >(const char* s, uint32_t n, int64_t*  o) { return parseSigned<int64_t, uint64_t>(s, n, INT64_MIN, INT64_MAX, o); }
+template <> inline bool parse<float   >(const char* s, uint32_t n, float*    o) { return parseFloat (s, n, o); }
+template <> inline bool parse<double  >(const char* s, uint32_t n, double*   o) { return parseDouble(s, n, o); }
+template <> inline bool parse<char    >(const char* s, uint32_t n, char*     o) { *o = n ? s[0] : '\0'; return true; }
+template <> inline bool parse<bool    >(const char* s, uint32_t n, bool*     o)
+{
+    if (n == 1 && (s[0] == '0' || s[0] == '1')) { *o = (s[0] == '1'); return true; }
+    if (n == 4 && iequalN(s, "true", 4))  { *o = true;  return true; }
+    if (n == 5 && iequalN(s, "false", 5)) { *o = false; return true; }
+    return false;
+}
+
+/**
+ * @brief Format @p value as text, selected at compile time.
+ * @tparam T One of uint8_t..uint64_t, int8_t..int64_t, float, double, bool, char.
+ * @param out    Destination buffer (always NUL-terminated when @p outCap > 0).
+ * @param outCap Capacity of @p out in bytes.
+ * @param value  Value to format.
+ * @return Length of the full text (excluding NUL); truncated if ≥ @p outCap, like `snprintf`.
+ */
+template <typename T> size_t format(char* out, size_t outCap, T value);
+
+template <> inline size_t format<uint8_t >(char* o, size_t c, uint8_t  v) { return formatUnsigned<uint8_t >(o, c, v); }
+template <> inline size_t format<uint16_t>(char* o, size_t c, uint16_t v) { return formatUnsigned<uint16_t>(o, c, v); }
+template <> inline size_t format<uint32_t>(char* o, size_t c, uint32_t v) { return formatUnsigned<uint32_t>(o, c, v); }
+template <> inline size_t format<uint64_t>(char* o, size_t c, uint64_t v) { return formatUnsigned<uint64_t>(o, c, v); }
+template <> inline size_t format<int8_t  >(char* o, size_t c, int8_t   v) { return formatSigned<int8_t,  uint8_t >(o, c, v); }
+template <> inline size_t format<int16_t >(char* o, size_t c, int16_t  v) { return formatSigned<int16_t, uint16_t>(o, c, v); }
+template <> inline size_t format<int32_t >(char* o, size_t c, int32_t  v) { return formatSigned<int32_t, uint32_t>(o, c, v); }
+template <> inline size_t format<int64_t >(char* o, size_t c, int64_t  v) { return formatSigned<int64_t, uint64_t>(o, c, v); }
+template <> inline size_t format<float   >(char* o, size_t c, float    v) { return formatDouble(o, c, (double)v); }
+template <> inline size_t format<double  >(char* o, size_t c, double   v) { return formatDouble(o, c, v); }
+template <> inline size_t format<char    >(char* o, size_t c, char     v) { return formatChars(o, c, &v, 1); }
+template <> inline size_t format<bool    >(char* o, size_t c, bool     v) { return v ? formatChars(o, c, "true", 4) : formatChars(o, c, "false", 5); }
+
+/**
+ * @brief Maps a value type onto the `format<T>()` specialisation that prints it.
+ * @details Plain `int`, `long`, `unsigned` etc. go to the fixed-width integer of the same
+ *          size and signedness (`int32_t` is `long` on some targets and `int` on others).
+ *          Types without a mapping (pointers, classes) fail to compile instead of to link.
+ */
+template <size_t N, bool Signed> struct FormatInt;
+template <> struct FormatInt<1, false> { typedef uint8_t  type; };
+template <> struct FormatInt<2, false> { typedef uint16_t type; };
+template <> struct FormatInt<4, false> { typedef uint32_t type; };
+template <> struct FormatInt<8, false> { typedef uint64_t type; };
+template <> struct FormatInt<1, true > { typedef int8_t   type; };
+template <> struct FormatInt<2, true > { typedef int16_t  type; };
+template <> struct FormatInt<4, true > { typedef int32_t  type; };
+template <> struct FormatInt<8, true > { typedef int64_t  type; };
+
+template <typename T> struct FormatAs { typedef typename FormatInt<sizeof(T), (T(0) > T(-1))>::type type; };
+template <> struct FormatAs<float > { typedef float  type; };
+template <> struct FormatAs<double> { typedef double type; };
+template <> struct FormatAs<char  > { typedef char   type; };
+template <> struct FormatAs<bool  > { typedef bool   type; };
+
+// ----- Radix-aware integers and hex dumps -----
+
+/**
+ * @brief Parse an unsigned magnitude in base 2, 8, 10 or 16.
+ * @param s        Characters (not necessarily NUL-terminated), without sign.
+ * @param n        Number of characters.
+ * @param radix    2, 8, 10, 16, or 0 to auto-detect: `0x`/`0X` → 16, `0b`/`0B` → 2,
+ *                 `0o`/`0O` → 8, trailing `h`/`H` → 16, otherwise 10. The suffix wins over
+ *                 a prefix (`0BEEFh` → 0xBEEF). With an explicit radix the matching
+ *                 prefix/suffix is still accepted.
+ * @param maxValue Largest accepted value.
+ * @param out      Destination (written only on success).
+ * @return false on syntax error, unsupported radix or value > @p maxValue.
+ */
+bool parseRadix(const char* s, uint32_t n, uint8_t radix, uint64_t maxValue, uint64_t* out);
+
+/**
+ * @brief Parse an integer @p T with radix handling (see ::parseRadix).
+ * @details Signed types accept a leading '-' / '+' before the prefix (e.g. `-0x80`).
+ */
+template <typename T> bool parseRadix(const char* s, uint32_t n, uint8_t radix, T* out);
+
+/** @brief Shared body of the signed ::parseRadix specializations. */
+template <typename S, typename U>
+inline bool parseRadixSigned(const char* s, uint32_t n, uint8_t radix, S minValue, S maxValue, S* out)
+{
+    bool neg = false;
+    if (n && (s[0] == '+' || s[0] == '-')) { neg = (s[0] == '-'); ++s; --n; }
+    uint64_t mag = 0;
+    const uint64_t limit = neg ? (uint64_t)(U)((U)0 - (U)minValue) : (uint64_t)maxValue;
+    if (!parseRadix(s, n, radix, limit, &mag)) return false;
+    *out = neg ? (S)((U)0 - (U)mag) : (S)mag;
+    return true;
+}
+
+/** @brief Shared body of the unsigned ::parseRadix specializations. */
+template <typename U>
+inline bool parseRadixUnsigned(const char* s, uint32_t n, uint8_t radix, U maxValue, U* out)
+{
+    if (n && s[0] == '+') { ++s; --n; }
+    uint64_t v = 0;
+    if (!parseRadix(s, n, radix, maxValue, &v)) return false;
+    *out = (U)v;
+    return true;
+}
+
+template <> inline bool parseRadix<uint8_t >(const char* s, uint32_t n, uint8_t r, uint8_t*  o) { return parseRadixUnsigned<uint8_t >(s, n, r, UINT8_MAX,  o); }
+template <> inline bool parseRadix<uint16_t>(const char* s, uint32_t n, uint8_t r, uint16_t* o) { return parseRadixUnsigned<uint16_t>(s, n, r, UINT16_MAX, o); }
+template <> inline bool parseRadix<uint32_t>(const char* s, uint32_t n, uint8_t r, uint32_t* o) { return parseRadixUnsigned<uint32_t>(s, n, r, UINT32_MAX, o); }
+template <> inline bool parseRadix<uint64_t>(const char* s, uint32_t n, uint8_t r, uint64_t* o) { return parseRadixUnsigned<uint64_t>(s, n, r, UINT64_MAX, o); }
+template <> inline bool parseRadix<int8_t  >(const char* s, uint32_t n, uint8_t r, int8_t*   o) { return parseRadixSigned<int8_t,  uint8_t >(s, n, r, INT8_MIN,  INT8_MAX,  o); }
+template <> inline bool parseRadix<int16_t >(const char* s, uint32_t n, uint8_t r, int16_t*  o) { return parseRadixSigned<int16_t, uint16_t>(s, n, r, INT16_MIN, INT16_MAX, o); }
+template <> inline bool parseRadix<int32_t >(const char* s, uint32_t n, uint8_t r, int32_t*  o) { return parseRadixSigned<int32_t, uint32_t>(s, n, r, INT32_MIN, INT32_MAX, o); }
+template <> inline bool parseRadix<int64_t >(const char* s, uint32_t n, uint8_t r, int64_t*  o) { return parseRadixSigned<int64_t, uint64_t>(s, n, r, INT64_MIN, INT64_MAX, o); }
+
+// C-string converters with a radix (0 = auto-detect prefix/suffix).
+inline bool stringToUint8 (const char* s, uint8_t*  out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToUint16(const char* s, uint16_t* out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToUint32(const char* s, uint32_t* out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToUint64(const char* s, uint64_t* out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToInt8  (const char* s, int8_t*   out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToInt16 (const char* s, int16_t*  out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToInt32 (const char* s, int32_t*  out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+inline bool stringToInt64 (const char* s, int64_t*  out, uint8_t radix){ return s && out && parseRadix(s, (uint32_t)strlen(s), radix, out); }
+
+/**
+ * @brief Validate @p data for @p type, parsing integer types with @p radix.
+ * @note Non-integer types ignore @p radix (same as ::checkValueType(const char*,dataTypeEnum)).
+ */
+bool checkValueType(const char* data, dataTypeEnum type, uint8_t radix);
+
+/**
+ * @brief Parse @p str to @p type, parsing integer types with @p radix.
+ * @note Non-integer types ignore @p radix (same as the two-argument form).
+ */
+bool stringToNumber(const char* str, dataValueUnion* num, dataTypeEnum type, uint8_t radix);
+
+/** @brief Uppercase hex digit for the low nibble of @p v (table lookup). */
+constexpr char hexDigit(uint8_t v) { return "0123456789ABCDEF"[v & 0x0F]; }
+
+/**
+ * @brief Value of a hex digit.
+ * @return 0..15, or 0xFF if @p c is not a hex digit.
+ */
+constexpr uint8_t hexValue(char c)
+{
+    return (c >= '0' && c <= '9') ? (uint8_t)(c - '0')
+         : ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') ? (uint8_t)((c | 0x20) - 'a' + 10) : (uint8_t)0xFF;
+}
+
+/**
+ * @brief Format @p value as fixed-width uppercase hex (2 digits per byte, leading zeros kept).
+ * @tparam T Unsigned or signed integer type (signed values print their two's complement bits).
+ * @param out    Destination (always NUL-terminated when @p outCap > 0).
+ * @param outCap Capacity of @p out.
+ * @param value  Value to format.
+ * @param prefix Prepend `0x`.
+ * @return Length of the full text (excluding NUL), like `snprintf`.
+ */
+template <typename T>
+inline size_t formatHex(char* out, size_t outCap, T value, bool prefix = false)
+{
+    char tmp[2 + 2 * sizeof(T)];
+    size_t len = 0;
+    if (prefix) { tmp[len++] = '0'; tmp[len++] = 'x'; }
+    for (int shift = (int)(8 * sizeof(T)) - 4; shift >= 0; shift -= 4)
+        tmp[len++] = hexDigit((uint8_t)((uint64_t)value >> shift));
+    return formatChars(out, outCap, tmp, len);
+}
+
+/**
+ * @brief Hex-dump @p size bytes as uppercase pairs ("DEADBEEF").
+ * @param out    Destination; needs `2*size + 1` bytes for the full dump.
+ * @param outCap Capacity of @p out. Output is truncated to whole bytes and NUL-terminated.
+ * @param data   Source bytes.
+ * @param size   Number of source bytes.
+ * @return Number of characters written (excluding NUL).
+ */
+size_t hexEncode(char* out, size_t outCap, const uint8_t* data, size_t size);
+
+/**
+ * @brief Decode a hex dump ("DEADBEEF", any case) into bytes.
+ * @param out     Destination; may alias @p text (decodes in place).
+ * @param outCap  Capacity of @p out in bytes.
+ * @param text    Hex characters.
+ * @param size    Number of hex characters (must be even).
+ * @param written Optional: number of bytes decoded.
+ * @return false on odd length, non-hex character or insufficient @p outCap
+ *         (bytes before the error are still written and counted).
+ */
+bool hexDecode(uint8_t* out, size_t outCap, const char* text, size_t size, size_t* written = nullptr);
+
+/**
+ * @brief Base64-encode (RFC 4648, padded) @p size bytes.
+ * @param out    Destination; needs `4*ceil(size/3) + 1` bytes for the full text.
+ * @param outCap Capacity of @p out. Output is truncated to whole quanta and NUL-terminated.
+ * @param data   Source bytes.
+ * @param size   Number of source bytes.
+ * @return Number of characters written (excluding NUL).
+ *
+ * @note Uses SSSE3 (12 bytes per step) when available; scalar otherwise.
+ */
+size_t base64Encode(char* out, size_t outCap, const uint8_t* data, size_t size);
+
+/**
+ * @brief Decode padded Base64 text.
+ * @param out     Destination; may alias @p text (decodes in place).
+ * @param outCap  Capacity of @p out in bytes.
+ * @param text    Base64 characters (no whitespace).
+ * @param size    Number of characters (must be a multiple of 4).
+ * @param written Optional: number of bytes decoded.
+ * @return false on bad length, invalid character, data after padding or
+ *         insufficient @p outCap (bytes before the error are still written and counted).
+ */
+bool base64Decode(uint8_t* out, size_t outCap, const char* text, size_t size, size_t* written = nullptr);
+
 } // namespace StreamEx_utility
 
 // ###############################################################################
@@ -289,6 +1047,69 @@ enum class StreamExError : int8_t
   NotEnoughData    ///< Requested more data than available
 };
 
+class StreamEx;
+
+/**
+ * @enum StreamExWatermark
+ * @brief Fill-level crossings reported by ::StreamEx (also bit flags for `takeWatermarkEvents()`).
+ */
+enum class StreamExWatermark : uint8_t
+{
+  TxHigh = 0x01,   ///< TX fill rose to its high watermark
+  TxLow  = 0x02,   ///< TX fill fell back to its low watermark
+  RxHigh = 0x04,   ///< RX fill rose to its high watermark
+  RxLow  = 0x08    ///< RX fill fell back to its low watermark
+};
+
+/**
+ * @brief Watermark callback.
+ * @param stream  Stream whose fill level crossed a watermark (may be used from the callback).
+ * @param event   Crossing that happened.
+ * @param context User pointer registered with `setWatermarkHandler()`.
+ */
+typedef void (*StreamExWatermarkHandler)(StreamEx& stream, StreamExWatermark event, void* context);
+
+/**
+ * @def STREAMEX_XON
+ * @brief Software flow control: "resume sending" (DC1).
+ */
+#define STREAMEX_XON  ((char)0x11)
+
+/**
+ * @def STREAMEX_XOFF
+ * @brief Software flow control: "stop sending" (DC3).
+ */
+#define STREAMEX_XOFF ((char)0x13)
+
+/**
+ * @enum StreamExFlowControl
+ * @brief How ::StreamEx throttles the peer when RX fills up (see `setFlowControl()`).
+ */
+enum class StreamExFlowControl : uint8_t
+{
+  None = 0,   ///< No flow control (RX slides its window on overflow)
+  XonXoff,    ///< Software: send XOFF/XON, obey the peer's XOFF/XON found in RX
+  RtsCts      ///< Hardware: RTS through the flow handler, CTS through `setTxPaused()`
+};
+
+/**
+ * @brief Flow-control hook (e.g. drive the RTS pin).
+ * @param stream  Stream whose RX crossed a watermark.
+ * @param stop    true: ask the peer to stop sending (deassert RTS); false: let it resume.
+ * @param context User pointer registered with `setFlowControl()`.
+ */
+typedef void (*StreamExFlowHandler)(StreamEx& stream, bool stop, void* context);
+
+/**
+ * @struct StreamExRxStamp
+ * @brief Arrival record of one RX chunk (see `setRxTimestamps()`).
+ */
+struct StreamExRxStamp
+{
+    uint32_t end;    ///< Stream offset just past the chunk's last byte (counts all RX ever read, wraps).
+    uint32_t time;   ///< Arrival time of the chunk (caller's clock, e.g. `micros()`).
+};
+
 /**
  * @class StreamEx
  * @brief Buffered, non-allocating I/O helper with user-owned TX/RX buffers (Arduino-like API).
@@ -357,15 +1178,400 @@ class StreamEx
 
     /**
      * @brief Get the TX buffer base pointer (caller-owned memory).
-     * @return Pointer to TX buffer (may be nullptr).
+     * @return Pointer to TX buffer (may be nullptr). In segmented and bip mode: the oldest
+     *         unread byte, valid for `availableTxContiguous()` bytes.
      */
-    const char* getTxBuffer() const { return _txBuffer; }
+    const char* getTxBuffer() const { return _txPool ? _txChunks.front() : (_txBip.data ? _txBip.front() : _txBuffer); }
     
     /**
      * @brief Get the RX buffer base pointer (caller-owned memory).
-     * @return Pointer to RX buffer (may be nullptr).
+     * @return Pointer to RX buffer (may be nullptr). In segmented, bip and DMA ring mode:
+     *         the oldest unread byte, valid for `availableRxContiguous()` bytes.
+     */
+    const char* getRxBuffer() const
+    {
+        if (_rxRing) return _rxRing + _rxRingIndex;
+        if (_rxPool) return _rxChunks.front();
+        return _rxBip.data ? _rxBip.front() : _rxBuffer;
+    }
+
+    /**
+     * @brief Switch TX to segmented mode backed by @p pool (nullptr restores the linear buffer).
+     * @param pool  Chunk pool shared with any number of streams (must outlive this stream).
+     * @param quota Maximum chunks this stream may hold (0 = unlimited), so one busy
+     *              stream cannot starve the others.
+     *
+     * Pending TX data is discarded. In segmented mode appends fill pool chunks and never
+     * `memmove`; drained chunks go straight back to the pool. When the pool or the quota
+     * runs dry the append stores what fits, sets ::StreamExError::BufferOverflow and
+     * **keeps** the oldest data (no sliding window).
+     */
+    void setTxPool(StreamExChunkPool* pool, uint16_t quota = 0);
+
+    /**
+     * @brief Switch RX to segmented mode backed by @p pool (nullptr restores the linear buffer).
+     * @param pool  Chunk pool (may be the TX pool and shared with other streams).
+     * @param quota Maximum chunks this stream may hold (0 = unlimited).
+     *
+     * Same semantics as `setTxPool()`. Byte-wise readers (`read()`, `peek()`, the pop and
+     * decode APIs) work across chunks; frame parsers that scan `getRxBuffer()` (commands,
+     * NMEA, Modbus) only see the head chunk and need a linear RX buffer.
+     */
+    void setRxPool(StreamExChunkPool* pool, uint16_t quota = 0);
+
+    /** @brief Pool used by segmented RX mode (nullptr in linear mode). */
+    StreamExChunkPool* getRxPool() const { return _rxPool; }
+
+    /**
+     * @brief Bytes readable in one piece at `getRxBuffer()`.
+     * @return `availableRx()` in linear mode; the head chunk's unread bytes in segmented mode;
+     *         region A in bip mode; the bytes up to the ring end plus the wrapped bytes
+     *         mirrored into the slack at the last sync in DMA ring mode (see `setRxDmaRing()`).
+     */
+    uint32_t availableRxContiguous() const
+    {
+        if (_rxRing) return _rxRingContiguous();
+        if (_rxPool) return _rxChunks.frontSize();
+        return _rxBip.data ? _rxBip.frontSize() : _rxPosition;
+    }
+
+    /**
+     * @brief Bytes that can be appended to RX without dropping or losing data.
+     * @return Free linear space (one byte is kept for the NUL), room left under the pool and
+     *         quota, or in bip mode all unused bytes (RX packs its unread data to the start
+     *         of the buffer instead of opening region B, see `setRxBip()`).
+     */
+    uint32_t freeRx() const;
+
+    /** @brief Pool used by segmented TX mode (nullptr in linear mode). */
+    StreamExChunkPool* getTxPool() const { return _txPool; }
+
+    /**
+     * @brief Bytes readable in one piece at `getTxBuffer()` (hand these to the UART/DMA).
+     * @return `availableTx()` in linear mode; the head chunk's unread bytes in segmented mode;
+     *         region A in bip mode; 0 while TX is paused by flow control.
+     */
+    uint32_t availableTxContiguous() const
+    {
+        if (_txPaused) return 0;
+        return _txPool ? _txChunks.frontSize() : (_txBip.data ? _txBip.frontSize() : _txPosition);
+    }
+
+    /**
+     * @brief Bytes that can be appended to TX without dropping or losing data.
+     * @return Free linear space (one byte is kept for the NUL), room left under the pool and
+     *         quota, or the largest free run in bip mode (an append never splits there).
+     */
+    uint32_t freeTx() const;
+
+    // ---------------- Bip-buffer mode ----------------
+
+    /**
+     * @brief Switch TX to bip-buffer mode over @p buffer (nullptr restores the linear buffer).
+     * @param buffer Caller-owned storage.
+     * @param size   Size of @p buffer in bytes (all of it holds data; no NUL is kept).
+     *
+     * Pending TX data is discarded. Consuming data only moves an index (no `memmove`),
+     * every append and reservation is one contiguous run, and `getTxBuffer()` /
+     * `availableTxContiguous()` expose the front region. An append that does not fit in
+     * one run fails with ::StreamExError::BufferOverflow and keeps the queued data.
+     * `setTxBuffer()`, `setTxPool()` and `setTxPingPong()` leave bip mode.
+     */
+    void setTxBip(char* buffer, uint32_t size);
+
+    /**
+     * @brief Switch RX to bip-buffer mode over @p buffer (nullptr restores the linear buffer).
+     *
+     * Same semantics as `setTxBip()`, except that RX never opens region B: when an append
+     * or reservation does not fit after the unread data, that data is first moved to the
+     * start of the buffer (one `memmove` per wrap). Parsers therefore always see every
+     * unread byte in one run, also for a line that arrives in several pieces. Pointers
+     * from `getRxBuffer()` are invalidated by the next RX append.
+     */
+    void setRxBip(char* buffer, uint32_t size);
+
+    /**
+     * @brief Reserve @p size contiguous TX bytes to fill in place (e.g. an in-place encoder).
+     * @return Write pointer, or nullptr if `largestFreeTx()` is smaller (sets
+     *         ::StreamExError::BufferOverflow). Works in linear and bip mode.
+     * @note Nothing becomes visible until `commitTx()`; a new reservation replaces the open one.
+     *       In linear mode any append, consume or mode switch cancels the reservation (the
+     *       following `commitTx()` fails); bip mode keeps it valid while data is consumed.
+     */
+    char* reserveTx(uint32_t size);
+
+    /**
+     * @brief Publish the first @p size bytes of the last `reserveTx()`.
+     * @return false if @p size exceeds the reservation or the reservation was cancelled
+     *         (nothing is committed).
+     */
+    bool commitTx(uint32_t size);
+
+    /** @brief Reserve @p size contiguous RX bytes (e.g. a DMA target); see `reserveTx()`. */
+    char* reserveRx(uint32_t size);
+
+    /** @brief Publish the first @p size bytes of the last `reserveRx()`. */
+    bool commitRx(uint32_t size);
+
+    // ---------------- Mirrored ring mode ----------------
+
+    /**
+     * @brief Use mirrored memory (e.g. ::StreamExMirrorRing) as the TX buffer.
+     * @param base Start of the first view; `base[i + size]` must alias `base[i]`.
+     * @param size Size of one view in bytes.
+     *
+     * TX behaves exactly like a linear buffer of @p size bytes (contiguous views,
+     * NUL-terminated, sliding window on overflow), but consuming data advances the
+     * view through the ring instead of `memmove`-ing the rest, so it is O(1) for any
+     * buffer size. `setTxBuffer()`, `setTxPool()`, `setTxBip()` and `setTxPingPong()`
+     * leave mirrored mode.
+     */
+    void setTxMirror(char* base, uint32_t size);
+
+    /** @brief Use mirrored memory as the RX buffer; see `setTxMirror()`. */
+    void setRxMirror(char* base, uint32_t size);
+
+    /** @brief Largest contiguous TX reservation available now (0 in segmented mode). */
+    uint32_t largestFreeTx() const { return _txPool ? 0 : freeTx(); }
+
+    /** @brief Largest contiguous RX reservation available now (0 in segmented and DMA ring mode). */
+    uint32_t largestFreeRx() const { return (_rxPool || _rxRing) ? 0 : freeRx(); }
+
+    // ---------------- Ping-pong TX (DMA) ----------------
+
+    /**
+     * @brief Use two equally sized TX halves: the app appends into one while DMA reads the other.
+     * @param bufferA First half (becomes the fill buffer).
+     * @param bufferB Second half (handed to DMA after the first swap).
+     * @param size    Size of each half in bytes.
+     *
+     * All TX APIs keep working on the fill half. `txDmaStart()` swaps the halves and returns
+     * the filled one as a stable region; `txDmaComplete()` (ISR-safe) releases it. Calling
+     * `setTxBuffer()` or `setTxPool()` leaves ping-pong mode.
+     */
+    void setTxPingPong(char* bufferA, char* bufferB, uint32_t size);
+
+    /**
+     * @brief Hand the filled half to the transport and continue appending into the other one.
+     * @param size Receives the number of bytes to transmit (0 if nothing was started).
+     * @return Start of the region to transmit, or nullptr if not in ping-pong mode, a
+     *         transfer is still in flight, or TX is empty.
+     *
+     * @note Call from thread context (e.g. `loop()` or right after appending), not from the
+     *       DMA interrupt: the swap must not race an append in progress.
+     */
+    const char* txDmaStart(uint32_t* size);
+
+    /**
+     * @brief Report that the region from `txDmaStart()` has been sent (ISR-safe: one atomic store).
+     * @post The half becomes the next fill target; `txDmaBusy()` is false.
+     */
+    void txDmaComplete() { __atomic_store_n(&_txDmaBusy, (uint8_t)0, __ATOMIC_RELEASE); }
+
+    /** @brief true while a region from `txDmaStart()` is in flight. */
+    bool txDmaBusy() const { return __atomic_load_n(&_txDmaBusy, __ATOMIC_ACQUIRE) != 0; }
+
+    /** @brief Bytes in the region handed out by the last `txDmaStart()` (0 when idle). */
+    uint32_t txDmaSize() const { return txDmaBusy() ? _txDmaSize : 0; }
+
+    // ---------------- Circular DMA RX ----------------
+
+    /**
+     * @brief Adopt a ring that a circular DMA channel writes; RX is read in place, never copied in.
+     * @param ring  Ring memory of `size + slack` bytes (DMA writes only the first @p size).
+     * @param size  Ring size programmed into the DMA channel.
+     * @param slack Extra bytes after the ring. When unread data wraps, up to @p slack wrapped
+     *              bytes are mirrored there so `getRxBuffer()` stays contiguous across the
+     *              wrap; make it at least the longest frame a parser must see in one piece.
+     *              The copy is made when the stream syncs with the DMA (any RX read,
+     *              `available()` or a parser's `process()`), never by the const queries.
+     *
+     * The write index only moves when the driver reports the DMA position with
+     * `rxDmaPosition()`. Every RX reader (`read()`, the pop and decode APIs, and the
+     * command/NMEA/Modbus ASCII parsers) consumes directly from the ring.
+     * `pushBackRxBuffer()` and `writeRxBuffer()` fail in this mode. If the DMA laps unread
+     * data, the next read drops all pending bytes and sets ::StreamExError::BufferOverflow.
+     * Calling `setRxBuffer()` or `setRxPool()` leaves ring mode.
+     *
+     * @note Start the DMA channel after this call, at position 0.
+     */
+    void setRxDmaRing(char* ring, uint32_t size, uint32_t slack = 0);
+
+    /**
+     * @brief Report the DMA write position (ISR-safe; call on half-transfer, transfer-complete and idle-line events).
+     * @param position Bytes written into the current lap, `0..size` (e.g. `size - NDTR`, or
+     *                 the `Size` argument of `HAL_UARTEx_RxEventCallback()`).
+     *
+     * @note A whole lap between two reports is indistinguishable from none; the half and
+     *       full events guarantee at most half a ring between reports.
+     */
+    void rxDmaPosition(uint32_t position);
+
+    // ---------------- Watermarks ----------------
+
+    /**
+     * @brief Report TX fill-level crossings instead of polling `availableTx()`.
+     * @param low  Low watermark in bytes (below @p high).
+     * @param high High watermark in bytes (0 disables TX watermarks).
+     *
+     * ::StreamExWatermark::TxHigh fires when the fill rises to @p high or above;
+     * ::StreamExWatermark::TxLow fires when it then falls to @p low or below (hysteresis:
+     * one event per crossing, no chatter around a single threshold). The current fill is
+     * checked right away, so a stream already above @p high reports TxHigh immediately.
+     */
+    void setTxWatermarks(uint32_t low, uint32_t high);
+
+    /**
+     * @brief Report RX fill-level crossings (same semantics as `setTxWatermarks()`).
+     * @note In DMA ring mode the fill is checked when the stream syncs with the DMA (any
+     *       RX read or `available()`), not from `rxDmaPosition()`.
+     */
+    void setRxWatermarks(uint32_t low, uint32_t high);
+
+    /**
+     * @brief Call @p handler on every watermark crossing (nullptr: flags only).
+     * @param handler Callback, invoked synchronously from the API call that changed the fill.
+     * @param context User pointer passed to @p handler.
+     */
+    void setWatermarkHandler(StreamExWatermarkHandler handler, void* context = nullptr)
+    {
+        _watchHandler = handler;
+        _watchContext = context;
+    }
+
+    /**
+     * @brief Crossings since the last call, as ::StreamExWatermark bits; clears them.
+     * @return e.g. `events & (uint8_t)StreamExWatermark::RxHigh`.
      */
-    const char* getRxBuffer() const { return _rxBuffer; }
+    uint8_t takeWatermarkEvents()
+    {
+        const uint8_t events = _watchEvents;
+        _watchEvents = 0;
+        return events;
+    }
+
+    /** @brief true between a TX high crossing and the following low crossing. */
+    bool txAboveHigh() const { return _txWatch.above; }
+
+    /** @brief true between an RX high crossing and the following low crossing. */
+    bool rxAboveHigh() const { return _rxWatch.above; }
+
+    // ---------------- Flow control ----------------
+
+    /**
+     * @brief Throttle the peer from the RX watermarks instead of overrunning RX.
+     * @param mode    ::StreamExFlowControl::XonXoff or ::StreamExFlowControl::RtsCts (None turns it off).
+     * @param handler Called with stop=true on every RX high crossing and stop=false on every
+     *                low crossing (drive RTS here; optional for XON/XOFF).
+     * @param context User pointer passed to @p handler.
+     *
+     * Set the thresholds with `setRxWatermarks()`: the high mark must leave room for what
+     * the peer still sends after being told to stop (its FIFO plus bytes in flight).
+     *
+     * In XON/XOFF mode an RX high crossing queues XOFF and a low crossing XON; the
+     * transport sends them ahead of TX data via `takeTxControl()`. XON/XOFF received
+     * through `pushBackRxBuffer()` are removed from the data and pause / resume TX.
+     *
+     * While TX is paused (peer's XOFF, or CTS reported through `setTxPaused()`), the drain
+     * APIs (`popFrontTxBuffer()`, `popAllTxBuffer()`, `txDmaStart()`,
+     * `availableTxContiguous()`) hand out nothing; appends keep queueing.
+     */
+    void setFlowControl(StreamExFlowControl mode, StreamExFlowHandler handler = nullptr, void* context = nullptr);
+
+    /**
+     * @brief Flow-control byte to send before any further TX data.
+     * @return ::STREAMEX_XOFF or ::STREAMEX_XON (and clears it), or -1 if none is pending.
+     */
+    int takeTxControl()
+    {
+        const int c = _txControl;
+        _txControl = -1;
+        return c;
+    }
+
+    /**
+     * @brief Pause or resume TX draining (ISR-safe; e.g. from the CTS pin interrupt).
+     * @param paused true: hold TX data back (peer not ready), false: resume.
+     */
+    void setTxPaused(bool paused) { _txPaused = paused; }
+
+    /** @brief true while TX draining is paused by flow control. */
+    bool txPaused() const { return _txPaused; }
+
+    // ---------------- RX timestamps ----------------
+
+    /**
+     * @brief Record the arrival time of every chunk pushed into RX.
+     * @param stamps Caller-owned record ring (nullptr disables); 8 bytes per record.
+     * @param count  Records in @p stamps; one per chunk still unread is needed.
+     *
+     * Each `pushBackRxBuffer()` appends one ::StreamExRxStamp (the plain overload stamps
+     * `micros()`). Records are dropped as the read cursor passes them, so the oldest one
+     * always belongs to the next unread byte. When the ring is full, a new chunk merges
+     * into the newest record and reports that record's (earlier) time. Bytes that enter
+     * RX by other means (`commitRx()`, `writeRxBuffer()`) report the time of the next
+     * stamped chunk. Not available in DMA ring mode.
+     */
+    void setRxTimestamps(StreamExRxStamp* stamps, uint16_t count);
+
+    /**
+     * @brief Arrival time of the unread RX byte at @p offset (0 = next byte to read).
+     * @param offset Byte position relative to the read cursor.
+     * @param time   Receives the arrival time.
+     * @retval true  Found (O(1) for the next byte, O(log records) elsewhere).
+     * @retval false Timestamps off, @p offset beyond the unread data, or byte not stamped.
+     */
+    bool rxTimestamp(uint32_t offset, uint32_t* time) const;
+
+    /**
+     * @brief Arrival times of the first and last byte of the next @p size unread bytes
+     *        (stamp a frame before consuming it).
+     * @retval true Both found.
+     */
+    bool rxFrameTimes(uint32_t size, uint32_t* first, uint32_t* last) const
+    {
+        return size && rxTimestamp(0, first) && rxTimestamp(size - 1, last);
+    }
+
+    // ---------------- TX pacing ----------------
+
+    /**
+     * @brief Limit `popTxPaced()` to a byte rate with a token bucket.
+     * @param bytesPerSecond Sustained rate (0 = unpaced).
+     * @param burst          Bucket size: most bytes handed out at once after an idle period
+     *                       (e.g. the modem's input buffer).
+     *
+     * The bucket starts full. Tokens accrue continuously (no rounding loss between calls)
+     * and are spent only on bytes actually popped. Resets the throttled-time statistic.
+     */
+    void setTxRate(uint32_t bytesPerSecond, uint32_t burst);
+
+    /**
+     * @brief Pop as many TX bytes as the rate allows right now.
+     * @param out     Destination buffer.
+     * @param maxSize Capacity of @p out.
+     * @param nowUs   Current time in µs (e.g. `micros()`; wraps).
+     * @return Bytes popped (0 if TX is empty, paused by flow control, or out of tokens).
+     */
+    uint32_t popTxPaced(char* out, uint32_t maxSize, uint32_t nowUs);
+
+    /**
+     * @brief Time until @p size bytes will be allowed, counted from the last `popTxPaced()`.
+     * @return µs to wait (0 if allowed now or unpaced); use it to arm a timer instead of polling.
+     *         Sizes above the burst count as the burst.
+     */
+    uint32_t txPaceWaitUs(uint32_t size) const;
+
+    /**
+     * @brief µs during which queued TX data was held back by the rate limit; clears it.
+     * @note Flow-control pauses are not counted.
+     */
+    uint32_t takeTxThrottledUs()
+    {
+        const uint32_t us = _txThrottledUs;
+        _txThrottledUs = 0;
+        return us;
+    }
 
     /**
      * @brief Clear the TX buffer content and reset the TX write position.
@@ -459,9 +1665,17 @@ class StreamEx
      *              (sets ::StreamExError::BufferOverflow).
      *
      * @note One byte is reserved for NUL termination when possible.
+     * @note With XON/XOFF flow control, ::STREAMEX_XON / ::STREAMEX_XOFF are removed from
+     *       @p data and resume / pause TX (see `setFlowControl()`).
      */
     bool pushBackRxBuffer(const char* data, uint32_t dataSize = 1);
 
+    /**
+     * @brief `pushBackRxBuffer()` with an explicit arrival time (e.g. captured in the UART ISR).
+     * @param timestamp Arrival time recorded for this chunk when RX timestamps are on.
+     */
+    bool pushBackRxBuffer(const char* data, uint32_t dataSize, uint32_t timestamp);
+
     #if STREAMEX_ENABLE_STD_STRING
       /**
        * @brief Append a std::string to RX (optional).
@@ -505,7 +1719,8 @@ class StreamEx
      * @param data     Destination buffer (must be non-null).
      * @param dataSize Number of bytes to pop; clamped to available.
      * @retval true  Exactly @p dataSize bytes were popped.
-     * @retval false Fewer bytes were available (sets ::StreamExError::NotEnoughData).
+     * @retval false Fewer bytes were available, or TX is paused by flow control
+     *              (sets ::StreamExError::NotEnoughData).
      */
     bool popFrontTxBuffer(char* data, uint32_t dataSize = 1);
 
@@ -562,7 +1777,8 @@ class StreamEx
      * @param data    Destination buffer (must be non-null).
      * @param maxSize Maximum number of bytes to copy.
      * @retval true  Copied all available or exactly @p maxSize bytes.
-     * @retval false Invalid args (e.g., maxSize=0 → sets ::StreamExError::SizeZero).
+     * @retval false Invalid args (e.g., maxSize=0 → sets ::StreamExError::SizeZero), or TX is
+     *              paused by flow control (nothing copied).
      */
     bool popAllTxBuffer(char* data, uint32_t maxSize);
 
@@ -593,6 +1809,54 @@ class StreamEx
      */
     bool popAllRxBuffer(char* data, uint32_t maxSize);
 
+    // ---------------- Streaming codecs (no scratch buffers) ----------------
+
+    /**
+     * @brief Hex-encode @p dataSize bytes directly into the TX buffer.
+     * @param data     Source bytes (must be non-null).
+     * @param dataSize Number of source bytes.
+     * @return Number of source bytes consumed (only whole bytes that fit).
+     *
+     * @details Unlike `pushBackTxBuffer()`, nothing is dropped on overflow: encoding stops
+     *          when TX is full and ::StreamExError::BufferOverflow is set, so the caller can
+     *          drain TX and continue from `data + consumed`.
+     */
+    uint32_t pushBackTxHex(const uint8_t* data, uint32_t dataSize);
+
+    /**
+     * @brief Base64-encode @p dataSize bytes directly into the TX buffer.
+     * @param data     Source bytes (must be non-null).
+     * @param dataSize Number of source bytes.
+     * @param final    true if this is the last chunk (emit a padded quantum for a 1–2 byte tail).
+     * @return Number of source bytes consumed: a multiple of 3 unless @p final, so the
+     *         caller re-submits the unconsumed tail with the next chunk.
+     *
+     * @details Stops when TX is full (see `pushBackTxHex()`).
+     */
+    uint32_t pushBackTxBase64(const uint8_t* data, uint32_t dataSize, bool final = true);
+
+    /**
+     * @brief Decode hex pairs from the front of RX straight into @p data.
+     * @param data    Destination (must be non-null).
+     * @param maxSize Capacity of @p data in bytes.
+     * @return Number of bytes decoded; the consumed characters are removed from RX.
+     *
+     * @details Stops at @p maxSize, at an incomplete trailing pair (waits for more input)
+     *          or at the first non-hex character (left in RX, e.g. a line terminator).
+     */
+    uint32_t popFrontRxHex(uint8_t* data, uint32_t maxSize);
+
+    /**
+     * @brief Decode Base64 quanta from the front of RX straight into @p data.
+     * @param data    Destination (must be non-null).
+     * @param maxSize Capacity of @p data in bytes (whole quanta only: keep ≥ 3).
+     * @return Number of bytes decoded; the consumed characters are removed from RX.
+     *
+     * @details Stops at a padded quantum, an incomplete quantum (waits for more input),
+     *          an invalid character (left in RX) or when @p data is full.
+     */
+    uint32_t popFrontRxBase64(uint8_t* data, uint32_t maxSize);
+
     /**
      * @brief Number of valid bytes currently stored in TX.
      * @return Count of bytes available in TX buffer.
@@ -603,7 +1867,12 @@ class StreamEx
      * @brief Number of valid bytes currently stored in RX.
      * @return Count of bytes available in RX buffer.
      */
-    uint32_t availableRx() const { return _rxPosition; }
+    uint32_t availableRx() const
+    {
+        if (!_rxRing) return _rxPosition;
+        const uint32_t fill = _rxRingWrittenNow() - _rxRingRead;
+        return (fill > _rxRingSize) ? 0 : fill;   // lapped: dropped by the next read
+    }
 
     // ---------------- Error helpers ----------------
 
@@ -694,18 +1963,176 @@ class StreamEx
     uint32_t  _txPosition    = 0;        ///< Current used length in TX buffer.
     uint32_t  _rxPosition    = 0;        ///< Current used length in RX buffer.
 
+    // ---------- Segmented mode (see setTxPool() / setRxPool()) ----------
+
+    StreamExChunkPool* _txPool   = nullptr;                     ///< Chunk pool; nullptr → linear TX buffer.
+    StreamExChunkPool* _rxPool   = nullptr;                     ///< Chunk pool; nullptr → linear RX buffer.
+    StreamExChunkQueue _txChunks = { nullptr, nullptr, 0, 0 };  ///< TX chunk chain (segmented mode).
+    StreamExChunkQueue _rxChunks = { nullptr, nullptr, 0, 0 };  ///< RX chunk chain (segmented mode).
+    uint16_t           _txQuota  = 0;                           ///< Max TX chunks (0 = unlimited).
+    uint16_t           _rxQuota  = 0;                           ///< Max RX chunks (0 = unlimited).
+
+    // ---------- Ping-pong TX (see setTxPingPong()) ----------
+
+    char*             _txSpare   = nullptr;  ///< Other half: in flight while `_txDmaBusy`, else the next fill target.
+    uint32_t          _txDmaSize = 0;        ///< Bytes handed out by the last `txDmaStart()`.
+    volatile uint8_t  _txDmaBusy = 0;        ///< Set by `txDmaStart()`, cleared by `txDmaComplete()`.
+
+    // ---------- Bip-buffer mode (see setTxBip() / setRxBip()) ----------
+
+    StreamExBipBuffer  _txBip    = { nullptr, 0, 0, 0, 0, 0, 0 };   ///< TX regions (data == nullptr → off).
+    StreamExBipBuffer  _rxBip    = { nullptr, 0, 0, 0, 0, 0, 0 };   ///< RX regions (data == nullptr → off).
+    uint32_t           _txReserved = 0;                             ///< Open linear-mode TX reservation.
+    uint32_t           _rxReserved = 0;                             ///< Open linear-mode RX reservation.
+
+    // ---------- Mirrored ring mode (see setTxMirror() / setRxMirror()) ----------
+
+    char*              _txMirror = nullptr;  ///< First view of mirrored TX memory; `_txBuffer` walks through it.
+    char*              _rxMirror = nullptr;  ///< First view of mirrored RX memory; `_rxBuffer` walks through it.
+
+    // ---------- Circular DMA RX (see setRxDmaRing()) ----------
+
+    char*             _rxRing        = nullptr;  ///< DMA ring; nullptr → linear or segmented RX.
+    uint32_t          _rxRingSize    = 0;        ///< Ring bytes written by DMA.
+    uint32_t          _rxRingSlack   = 0;        ///< Bytes after the ring for mirroring wrapped data.
+    uint32_t          _rxRingIndex   = 0;        ///< Read index inside the ring.
+    uint32_t          _rxRingMirrored = 0;       ///< Wrapped bytes currently copied into the slack.
+    uint32_t          _rxRingRead    = 0;        ///< Bytes consumed since `setRxDmaRing()` (wraps).
+    uint32_t          _rxRingDmaPos  = 0;        ///< Last reported DMA position (ISR side).
+    volatile uint32_t _rxRingWritten = 0;        ///< Bytes received since `setRxDmaRing()` (ISR side, wraps).
+
+    // ---------- Watermarks (see setTxWatermarks() / setRxWatermarks()) ----------
+
+    /** @brief One direction's thresholds and crossing state. */
+    struct Watermark
+    {
+        uint32_t low;     ///< Low watermark.
+        uint32_t high;    ///< High watermark (0 = off).
+        bool     above;   ///< High crossed, low not yet.
+    };
+
+    Watermark                _txWatch      = { 0, 0, false };  ///< TX thresholds.
+    Watermark                _rxWatch      = { 0, 0, false };  ///< RX thresholds.
+    StreamExWatermarkHandler _watchHandler = nullptr;          ///< Crossing callback (nullable).
+    void*                    _watchContext = nullptr;          ///< User pointer for `_watchHandler`.
+    uint8_t                  _watchEvents  = 0;                ///< Pending ::StreamExWatermark bits.
+
+    // ---------- Flow control (see setFlowControl()) ----------
+
+    StreamExFlowControl      _flowMode     = StreamExFlowControl::None;  ///< Active flow-control scheme.
+    StreamExFlowHandler      _flowHandler  = nullptr;                    ///< RTS hook (nullable).
+    void*                    _flowContext  = nullptr;                    ///< User pointer for `_flowHandler`.
+    int16_t                  _txControl    = -1;                         ///< Pending XON/XOFF to send, -1 = none.
+    volatile bool            _txPaused     = false;                      ///< Peer asked us to stop (XOFF / CTS).
+
+    /** @brief `pushBackRxBuffer()` without XON/XOFF filtering. */
+    bool _appendRx(const char* data, uint32_t dataSize);
+
+    // ---------- RX timestamps (see setRxTimestamps()) ----------
+
+    StreamExRxStamp*         _rxStamps     = nullptr;  ///< Caller-owned record ring (nullptr = off).
+    uint16_t                 _rxStampCount = 0;        ///< Records in `_rxStamps`.
+    uint16_t                 _rxStampHead  = 0;        ///< Oldest record.
+    uint16_t                 _rxStampSize  = 0;        ///< Records in use.
+    uint32_t                 _rxConsumed   = 0;        ///< RX bytes read or dropped so far (wraps).
+
+    // ---------- TX pacing (see setTxRate()) ----------
+
+    uint32_t                 _txRate        = 0;      ///< Bytes per second (0 = unpaced).
+    uint32_t                 _txBurst       = 0;      ///< Bucket size in bytes.
+    uint64_t                 _txTokens      = 0;      ///< Bucket fill in byte·µs (bytes × 10⁶).
+    uint32_t                 _txPaceLast    = 0;      ///< Time of the last refill.
+    bool                     _txPaceStarted = false;  ///< `_txPaceLast` is valid.
+    bool                     _txThrottled   = false;  ///< Last paced pop held data back.
+    uint32_t                 _txThrottledUs = 0;      ///< Throttled time since the last take.
+
+    /** @brief Account @p n RX bytes as consumed and drop the records they complete. */
+    void _consumedRx(uint32_t n)
+    {
+        _rxConsumed += n;
+        while (_rxStampSize && (int32_t)(_rxStamps[_rxStampHead].end - _rxConsumed) <= 0)
+        {
+            if (++_rxStampHead == _rxStampCount) _rxStampHead = 0;
+            --_rxStampSize;
+        }
+    }
+
+    /** @brief Record @p time for the bytes appended since the last record. */
+    void _stampRx(uint32_t time);
+
+    /** @brief Forget all records (RX storage replaced). */
+    void _resetRxStamps() { _rxStampHead = _rxStampSize = 0; }
+
+    /** @brief Check TX fill against its watermarks (one branch when disabled). */
+    void _watchTx() { if (_txWatch.high) _watch(_txWatch, _txPosition, StreamExWatermark::TxHigh, StreamExWatermark::TxLow); }
+
+    /** @brief Check RX fill against its watermarks. */
+    void _watchRx() { if (_rxWatch.high) _watch(_rxWatch, _rxPosition, StreamExWatermark::RxHigh, StreamExWatermark::RxLow); }
+
+    /** @brief Record and report a crossing of @p w at @p fill. */
+    void _watch(Watermark& w, uint32_t fill, StreamExWatermark high, StreamExWatermark low);
+
     // ---------- Internal helpers (buffer compaction) ----------
 
     /**
      * @brief Drop @p n bytes from TX front, compacting the remaining data to the start.
      * @param n Number of bytes to remove.
      */
-    void _dropFrontTx(uint32_t n);
+    void _dropFrontTx(uint32_t n) { _shrinkTx(n); _watchTx(); }
 
     /**
      * @brief Drop @p n bytes from RX front, compacting the remaining data to the start.
      * @param n Number of bytes to remove.
      */
-    void _dropFrontRx(uint32_t n);
+    void _dropFrontRx(uint32_t n) { _discardRx(n); _watchRx(); }
+
+    /** @brief `_dropFrontRx()` without the watermark check. */
+    void _discardRx(uint32_t n)
+    {
+        const uint32_t before = _rxPosition;
+        _shrinkRx(n);
+        _consumedRx(before - _rxPosition);
+    }
+
+    /** @brief `_dropFrontTx()` without the watermark check. */
+    void _shrinkTx(uint32_t n);
+
+    /** @brief Remove @p n bytes from the RX front (storage only, no accounting). */
+    void _shrinkRx(uint32_t n);
+
+    /** @brief Copy the first @p n TX bytes to @p out (either storage mode). */
+    void _peekTx(char* out, uint32_t n) const;
+
+    /** @brief Copy the first @p n RX bytes to @p out (any storage mode). */
+    void _peekRx(char* out, uint32_t n) const;
+
+    /** @brief true when TX is a plain linear buffer (no pool, no bip regions). */
+    bool _txLinear() const { return !_txPool && !_txBip.data; }
+
+    /** @brief true when RX is a plain linear buffer (no pool, bip regions or DMA ring). */
+    bool _rxLinear() const { return !_rxPool && !_rxBip.data && !_rxRing; }
+
+    /** @brief Load the ISR-owned write count (AVR: no 32-bit atomics, so briefly mask interrupts). */
+    uint32_t _rxRingWrittenNow() const
+    {
+#if defined(__AVR__)
+        const uint8_t sreg = SREG;
+        cli();
+        const uint32_t written = _rxRingWritten;
+        SREG = sreg;
+        return written;
+#else
+        return __atomic_load_n(&_rxRingWritten, __ATOMIC_ACQUIRE);
+#endif
+    }
+
+    /**
+     * @brief Ring mode: take the DMA write count into `_rxPosition`, dropping lapped data,
+     *        and mirror newly wrapped bytes into the slack.
+     */
+    void _syncRx();
+
+    /** @brief Ring mode: contiguous bytes at the read index (up to the ring end plus the mirrored slack). */
+    uint32_t _rxRingContiguous() const;
 };
 
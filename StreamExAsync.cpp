@@ -0,0 +1,109 @@
+/**
+ * @file StreamExAsync.cpp
+ * @brief Definitions for the coroutine adapter.
+ */
+#include "StreamExAsync.h"
+
+#if defined(STREAMEX_HAS_COROUTINES)
+
+#include <string.h>     // memchr, memcpy
+
+// ---------------- Awaiters ----------------
+
+StreamExAsync::LineAwaiter::LineAwaiter(StreamExAsync& owner, char* out, uint32_t outSize, char terminator)
+: Waiter{{}, &LineAwaiter::_poll}, _owner(owner), _out(out), _outSize(outSize), _terminator(terminator), _result(0)
+{
+    if (_out && _outSize) _out[0] = '\0';
+}
+
+bool StreamExAsync::LineAwaiter::_poll(Waiter& self)
+{
+    LineAwaiter& a = static_cast<LineAwaiter&>(self);
+    if (a._owner._closed || !a._out || a._outSize == 0) { a._result = -1; return true; }
+
+    // Bytes move into `_out` as they arrive, so a line may span RX chunks and RX is
+    // freed for the transport while the rest of the line is still on its way.
+    StreamEx& s = a._owner._stream;
+    const uint32_t room = a._outSize - 1;
+    while ((uint32_t)a._result < room && s.available() > 0)
+    {
+        const uint32_t run  = s.availableRxContiguous();
+        const uint32_t want = room - (uint32_t)a._result;
+        const char*    p    = s.getRxBuffer();
+        // One byte past the room: a terminator right after a full buffer ends this line.
+        const char*    end  = static_cast<const char*>(memchr(p, a._terminator, (run <= want) ? run : want + 1));
+        const uint32_t take = end ? (uint32_t)(end - p) : ((run < want) ? run : want);
+
+        memcpy(a._out + a._result, p, take);
+        a._result += (int32_t)take;
+        a._out[a._result] = '\0';
+        s.removeFrontRxBuffer(take + (end ? 1 : 0));
+        if (end) return true;
+    }
+    if ((uint32_t)a._result < room) return false;
+    // Full: deliver the piece, and drop the terminator if it is already the next byte.
+    if (s.availableRx() > 0 && s.getRxBuffer()[0] == a._terminator) s.removeFrontRxBuffer(1);
+    return true;
+}
+
+StreamExAsync::ExactAwaiter::ExactAwaiter(StreamExAsync& owner, char* out, uint32_t size)
+: Waiter{{}, &ExactAwaiter::_poll}, _owner(owner), _out(out), _size(out ? size : 0), _done(0)
+{}
+
+bool StreamExAsync::ExactAwaiter::_poll(Waiter& self)
+{
+    ExactAwaiter& a = static_cast<ExactAwaiter&>(self);
+    StreamEx& s = a._owner._stream;
+    const uint32_t avail = s.availableRx();
+    uint32_t take = a._size - a._done;
+    if (take > avail) take = avail;
+    if (take && s.popFrontRxBuffer(a._out + a._done, take)) a._done += take;
+    return a._done == a._size || a._owner._closed;
+}
+
+StreamExAsync::FlushAwaiter::FlushAwaiter(StreamExAsync& owner)
+: Waiter{{}, &FlushAwaiter::_poll}, _owner(owner)
+{}
+
+bool StreamExAsync::FlushAwaiter::_poll(Waiter& self)
+{
+    FlushAwaiter& a = static_cast<FlushAwaiter&>(self);
+    return a._owner._stream.availableTx() == 0 || a._owner._closed;
+}
+
+// ---------------- Adapter ----------------
+
+bool StreamExAsync::_park(Waiter*& slot, Waiter& waiter, std::coroutine_handle<> h)
+{
+    if (slot) return false;   // another coroutine already waits in this direction
+    waiter.handle = h;
+    slot = &waiter;
+    return true;
+}
+
+void StreamExAsync::_wake(Waiter*& slot)
+{
+    Waiter* w = slot;
+    if (!w || !w->poll(*w)) return;
+    // Free the slot first: the resumed coroutine usually awaits again right away.
+    slot = nullptr;
+    w->handle.resume();
+}
+
+uint32_t StreamExAsync::popTx(char* out, uint32_t maxSize)
+{
+    uint32_t size = _stream.availableTx();
+    if (size > maxSize) size = maxSize;
+    if (!out || size == 0 || !_stream.popFrontTxBuffer(out, size)) size = 0;
+    notifyTx();
+    return size;
+}
+
+void StreamExAsync::close()
+{
+    _closed = true;
+    _wake(_rxWaiter);
+    _wake(_txWaiter);
+}
+
+#endif // STREAMEX_HAS_COROUTINES
@@ -0,0 +1,189 @@
+#pragma once
+/**
+ * @file StreamExAsync.h
+ * @brief C++20 coroutine awaitables on top of ::StreamEx (`co_await readLine()`, `readExactly()`, `flushTx()`).
+ *
+ * @details
+ * A ::StreamExAsync wraps one stream and parks at most one reading and one
+ * flushing coroutine. The transport feeds it through `pushRx()` / `popTx()` (or
+ * calls `notifyRx()` / `notifyTx()` after touching the stream directly), and a
+ * parked coroutine is resumed right there once its condition holds:
+ *
+ * @code
+ *   StreamExAsync io(link);
+ *
+ *   MyTask session(StreamExAsync& io) {
+ *     char line[64];
+ *     for (;;) {
+ *       const int32_t n = co_await io.readLine(line, sizeof(line));
+ *       if (n < 0) co_return;                        // closed
+ *       io.stream().pushBackTxBuffer(line, (uint32_t)n);
+ *       co_await io.flushTx();
+ *     }
+ *   }
+ *
+ *   // transport:
+ *   io.pushRx(received, n);                          // may resume the session
+ *   const uint32_t sent = io.popTx(out, sizeof(out)); // may resume a flushTx()
+ * @endcode
+ *
+ * Waiting costs no thread and no allocation: each awaiter lives in the awaiting
+ * coroutine's frame and the wrapper only stores a pointer to it. The coroutine
+ * type itself (task, promise, frame allocation) is left to the application.
+ *
+ * Only compiled when the compiler provides C++20 coroutines (`<coroutine>`).
+ */
+
+#include "StreamEx.h"
+
+#if defined(__has_include)
+  #if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+    #define STREAMEX_HAS_COROUTINES 1
+  #endif
+#endif
+
+#if defined(STREAMEX_HAS_COROUTINES)
+
+#include <coroutine>      ///< std::coroutine_handle
+
+/**
+ * @class StreamExAsync
+ * @brief Coroutine adapter: one RX waiter and one TX waiter per stream.
+ *
+ * Not thread-safe: call the awaitables and the transport hooks from the same thread
+ * (typically an event loop serving many sessions).
+ */
+class StreamExAsync
+{
+  public:
+
+    /** @brief Parked awaiter: a resumption handle plus its readiness check. */
+    struct Waiter
+    {
+        std::coroutine_handle<> handle;              ///< Coroutine to resume.
+        bool (*poll)(Waiter& self);                  ///< true once the awaited condition holds (also collects data).
+    };
+
+    /**
+     * @brief Awaitable returned by `readLine()`; resumes with the line length, or -1 if closed.
+     * @note The line is collected into the destination as bytes arrive, so it is consumed
+     *       from RX even before the terminator shows up.
+     */
+    class LineAwaiter : public Waiter
+    {
+      public:
+        LineAwaiter(StreamExAsync& owner, char* out, uint32_t outSize, char terminator);
+        bool await_ready() { return poll(*this); }
+        bool await_suspend(std::coroutine_handle<> h)
+        {
+            if (_owner._park(_owner._rxWaiter, *this, h)) return true;
+            _result = -1;   // another reader is parked
+            return false;
+        }
+        int32_t await_resume() const { return _result; }
+      private:
+        StreamExAsync& _owner;       ///< Adapter this await belongs to.
+        char*          _out;         ///< Line destination.
+        uint32_t       _outSize;     ///< Capacity of `_out` including the NUL.
+        char           _terminator;  ///< Line terminator.
+        int32_t        _result;      ///< Bytes collected so far, -1 on close.
+        static bool _poll(Waiter& self);
+    };
+
+    /** @brief Awaitable returned by `readExactly()`; resumes with true once all bytes arrived. */
+    class ExactAwaiter : public Waiter
+    {
+      public:
+        ExactAwaiter(StreamExAsync& owner, char* out, uint32_t size);
+        bool await_ready() { return poll(*this); }
+        bool await_suspend(std::coroutine_handle<> h) { return _owner._park(_owner._rxWaiter, *this, h); }
+        bool await_resume() const { return _done == _size; }
+      private:
+        StreamExAsync& _owner;       ///< Adapter this await belongs to.
+        char*          _out;         ///< Destination.
+        uint32_t       _size;        ///< Bytes wanted.
+        uint32_t       _done;        ///< Bytes collected so far.
+        static bool _poll(Waiter& self);
+    };
+
+    /** @brief Awaitable returned by `flushTx()`; resumes with true once TX is empty. */
+    class FlushAwaiter : public Waiter
+    {
+      public:
+        explicit FlushAwaiter(StreamExAsync& owner);
+        bool await_ready() { return poll(*this); }
+        bool await_suspend(std::coroutine_handle<> h) { return _owner._park(_owner._txWaiter, *this, h); }
+        bool await_resume() const { return _owner._stream.availableTx() == 0; }
+      private:
+        StreamExAsync& _owner;       ///< Adapter this await belongs to.
+        static bool _poll(Waiter& self);
+    };
+
+    /** @brief Wrap @p stream (must outlive the adapter). */
+    explicit StreamExAsync(StreamEx& stream) : _stream(stream), _rxWaiter(nullptr), _txWaiter(nullptr), _closed(false) {}
+
+    /** @brief Wrapped stream. */
+    StreamEx& stream() { return _stream; }
+
+    // ---------------- Awaitables ----------------
+
+    /**
+     * @brief Await one line.
+     * @param out        Destination; receives the line without terminator, NUL-terminated.
+     * @param outSize    Capacity of @p out (lines longer than `outSize - 1` arrive in pieces;
+     *                   a terminator already received right after a full piece is consumed
+     *                   with it).
+     * @param terminator Line terminator.
+     * @return Awaitable yielding the line length, or -1 once `close()` was called.
+     */
+    LineAwaiter readLine(char* out, uint32_t outSize, char terminator = '\n') { return LineAwaiter(*this, out, outSize, terminator); }
+
+    /**
+     * @brief Await exactly @p size bytes (may exceed the RX buffer; collected as they arrive).
+     * @return Awaitable yielding true when complete, false if closed first.
+     */
+    ExactAwaiter readExactly(char* out, uint32_t size) { return ExactAwaiter(*this, out, size); }
+
+    /** @brief Await until the transport has drained TX. @return Awaitable yielding false if closed first. */
+    FlushAwaiter flushTx() { return FlushAwaiter(*this); }
+
+    // ---------------- Transport hooks ----------------
+
+    /** @brief Append received bytes to RX and resume the reader if it can proceed. */
+    bool pushRx(const char* data, uint32_t size)
+    {
+        const bool ok = _stream.pushBackRxBuffer(data, size);
+        notifyRx();
+        return ok;
+    }
+
+    /** @brief Take up to @p maxSize TX bytes for sending and resume a `flushTx()` once TX is empty. */
+    uint32_t popTx(char* out, uint32_t maxSize);
+
+    /** @brief RX changed behind the adapter's back: resume the reader if it can proceed. */
+    void notifyRx() { _wake(_rxWaiter); }
+
+    /** @brief TX drained behind the adapter's back: resume a `flushTx()` if TX is empty. */
+    void notifyTx() { _wake(_txWaiter); }
+
+    /** @brief End the session: parked and future awaits resume with their "closed" result. */
+    void close();
+
+    /** @brief true after `close()`. */
+    bool closed() const { return _closed; }
+
+  private:
+
+    StreamEx& _stream;    ///< Wrapped stream.
+    Waiter*   _rxWaiter;  ///< Parked reader (in its coroutine frame), or nullptr.
+    Waiter*   _txWaiter;  ///< Parked flusher, or nullptr.
+    bool      _closed;    ///< Set by `close()`.
+
+    /** @brief Park @p waiter in @p slot; false (resume at once) if the slot is taken. */
+    static bool _park(Waiter*& slot, Waiter& waiter, std::coroutine_handle<> h);
+
+    /** @brief Resume the waiter in @p slot if its condition holds. */
+    static void _wake(Waiter*& slot);
+};
+
+#endif // STREAMEX_HAS_COROUTINES
@@ -0,0 +1,99 @@
+/**
+ * @file StreamExBipBuffer.cpp
+ * @brief Definitions for the bip buffer.
+ */
+#include "StreamExBipBuffer.h"
+
+#include <string.h>     // memcpy, memmove
+
+void StreamExBipBuffer::init(char* storage, uint32_t storageSize)
+{
+    data     = storage;
+    capacity = storage ? storageSize : 0;
+    clear();
+}
+
+char* StreamExBipBuffer::reserve(uint32_t size)
+{
+    reserveSize = 0;
+    if (!data || size == 0) return nullptr;
+
+    // An empty buffer restarts at 0 so the whole array is one free run.
+    if (aStart == aEnd && bEnd == 0) aStart = aEnd = 0;
+
+    if (bEnd)
+    {
+        // B is active: it may only grow up to the start of A.
+        if (size > aStart - bEnd) return nullptr;
+        reserveStart = bEnd;
+    }
+    else if (size <= capacity - aEnd) reserveStart = aEnd;   // after A
+    else if (size <= aStart)          reserveStart = 0;      // opens region B
+    else return nullptr;
+
+    reserveSize = size;
+    return data + reserveStart;
+}
+
+bool StreamExBipBuffer::commit(uint32_t size)
+{
+    if (size > reserveSize) return false;
+    if (size)
+    {
+        if (bEnd == 0 && reserveStart == aEnd) aEnd += size;
+        else                                   bEnd  = reserveStart + size;
+    }
+    reserveSize = 0;
+    // A drained while the reservation was open: B is the front now.
+    if (aStart == aEnd) { aStart = 0; aEnd = bEnd; bEnd = 0; }
+    return true;
+}
+
+void StreamExBipBuffer::pack(uint32_t size)
+{
+    if (!data || bEnd || aStart == 0 || size <= capacity - aEnd) return;
+    memmove(data, data + aStart, aEnd - aStart);
+    aEnd  -= aStart;
+    aStart = 0;
+}
+
+bool StreamExBipBuffer::append(const char* src, uint32_t size)
+{
+    if (size == 0) return true;
+    char* w = reserve(size);
+    if (!w) return false;
+    memcpy(w, src, size);
+    return commit(size);
+}
+
+uint32_t StreamExBipBuffer::peek(char* out, uint32_t size) const
+{
+    const uint32_t a = aEnd - aStart;
+    uint32_t first = (size < a) ? size : a;
+    memcpy(out, data + aStart, first);
+    uint32_t second = size - first;
+    if (second > bEnd) second = bEnd;
+    memcpy(out + first, data, second);
+    return first + second;
+}
+
+uint32_t StreamExBipBuffer::drop(uint32_t size)
+{
+    uint32_t done = 0;
+    while (done < size && aEnd != aStart)
+    {
+        uint32_t n = aEnd - aStart;
+        if (n > size - done) n = size - done;
+        aStart += n;
+        done   += n;
+
+        if (aStart == aEnd)
+        {
+            // A drained: B becomes the new A. Without B, rewind to 0 unless a reservation
+            // is open after A (its commit must still extend A).
+            if (bEnd)              { aStart = 0; aEnd = bEnd; bEnd = 0; }
+            else if (!reserveSize) { aStart = aEnd = 0; }
+        }
+    }
+    return done;
+}
@@ -0,0 +1,100 @@
+#pragma once
+/**
+ * @file StreamExBipBuffer.h
+ * @brief Bipartite ("bip") buffer for the contiguous-region ::StreamEx storage mode.
+ *
+ * @details
+ * A bip buffer is a ring that never splits a reservation at the wrap. Data lives in
+ * up to two regions of one caller-owned array: region A is read from the front,
+ * and once the space after A is too small for a reservation, writes continue in
+ * region B at the start of the array. When A drains, B becomes A:
+ *
+ * @code
+ *   [ B B B . . . . A A A A A . . ]      reads: A (then B)    writes: after B
+ * @endcode
+ *
+ * Every reservation and the front read region are therefore contiguous, and
+ * consuming data is an index update instead of a `memmove`. The price is that the
+ * gap left after A while B is active cannot be used until A drains.
+ */
+
+#include <stdint.h>       ///< Fixed-width integer types
+
+/**
+ * @struct StreamExBipBuffer
+ * @brief Bip-buffer indices over caller-owned memory.
+ *
+ * Plain aggregate (no constructor) so it can live inside ::StreamEx; `init()` it
+ * before use. `data == nullptr` means "not in use".
+ */
+struct StreamExBipBuffer
+{
+    char*    data;         ///< Caller-owned storage (nullptr = unused).
+    uint32_t capacity;     ///< Size of @p data in bytes.
+    uint32_t aStart;       ///< Region A: first unread byte.
+    uint32_t aEnd;         ///< Region A: one past the last written byte.
+    uint32_t bEnd;         ///< Region B occupies `[0, bEnd)`; 0 = no region B.
+    uint32_t reserveStart; ///< Start of the open reservation.
+    uint32_t reserveSize;  ///< Size of the open reservation (0 = none).
+
+    /** @brief Adopt @p storage (nullptr detaches) and empty the buffer. */
+    void init(char* storage, uint32_t storageSize);
+
+    /** @brief Drop all data and any open reservation. */
+    void clear() { aStart = aEnd = bEnd = reserveStart = reserveSize = 0; }
+
+    /**
+     * @brief Reserve @p size contiguous bytes for writing.
+     * @return Start of the reservation, or nullptr if no contiguous region of @p size
+     *         bytes is free (see `largestFree()`). Replaces any open reservation.
+     */
+    char* reserve(uint32_t size);
+
+    /**
+     * @brief Publish the first @p size bytes of the open reservation and close it.
+     * @return false if @p size exceeds the reservation (nothing is committed).
+     */
+    bool commit(uint32_t size);
+
+    /**
+     * @brief Make room for @p size bytes after region A instead of in a new region B.
+     *
+     * If B is not active and @p size does not fit after A, the unread bytes of A are
+     * moved to the start of the array (one `memmove` per wrap). A partially written
+     * frame then stays contiguous with its continuation, which a reader that needs the
+     * whole frame in `front()` relies on. Call right before `reserve()` / `append()`.
+     */
+    void pack(uint32_t size);
+
+    /** @brief Reserve, copy and commit @p size bytes in one step (all or nothing). */
+    bool append(const char* src, uint32_t size);
+
+    /** @brief Largest reservation that `reserve()` can grant right now. */
+    uint32_t largestFree() const
+    {
+        if (bEnd) return aStart - bEnd;
+        const uint32_t tail = capacity - aEnd;
+        return (tail > aStart) ? tail : aStart;
+    }
+
+    /** @brief First unread byte (valid for `frontSize()` bytes). */
+    const char* front() const { return data + aStart; }
+
+    /** @brief Contiguous bytes readable at `front()` (region A). */
+    uint32_t frontSize() const { return aEnd - aStart; }
+
+    /** @brief Total bytes stored (regions A and B). */
+    uint32_t size() const { return (aEnd - aStart) + bEnd; }
+
+    /**
+     * @brief Copy up to @p size bytes from the front (A, then B) without consuming them.
+     * @return Number of bytes copied.
+     */
+    uint32_t peek(char* out, uint32_t size) const;
+
+    /**
+     * @brief Consume up to @p size bytes from the front (index updates only).
+     * @return Number of bytes dropped.
+     */
+    uint32_t drop(uint32_t size);
+};
@@ -0,0 +1,144 @@
+/**
+ * @file StreamExBroadcast.cpp
+ * @brief Definitions for the broadcast ring.
+ */
+#include "StreamExBroadcast.h"
+
+#include <string.h>     // memcpy
+
+#if defined(__AVR__)
+  #include <avr/interrupt.h>   // cli, SREG
+
+  // No 32-bit atomics: read the counters with interrupts briefly masked.
+  namespace {
+    uint32_t loadCounter(const volatile uint32_t& counter)
+    {
+      const uint8_t sreg = SREG;
+      cli();
+      const uint32_t value = counter;
+      SREG = sreg;
+      return value;
+    }
+  }
+  #define STREAMEX_BROADCAST_LOAD(counter)   loadCounter(counter)
+  #define STREAMEX_BROADCAST_FENCE_ACQUIRE() __asm__ __volatile__("" ::: "memory")
+#else
+  #define STREAMEX_BROADCAST_LOAD(counter)   (counter).load(std::memory_order_acquire)
+  #define STREAMEX_BROADCAST_FENCE_ACQUIRE() std::atomic_thread_fence(std::memory_order_acquire)
+#endif
+
+StreamExBroadcast::StreamExBroadcast(char* storage, uint32_t storageSize)
+: _storage(storage), _mask(0), _claimed(0), _written(0)
+{
+    if (!storage || storageSize == 0) { _storage = nullptr; return; }
+    uint32_t size = 1;
+    while (size <= storageSize / 2) size <<= 1;
+    _mask = size - 1;
+}
+
+uint32_t StreamExBroadcast::written() const
+{
+    return STREAMEX_BROADCAST_LOAD(_written);
+}
+
+void StreamExBroadcast::write(const char* data, uint32_t size)
+{
+    if (!_storage || !data || size == 0) return;
+    const uint32_t cap = _mask + 1;
+    uint32_t w = STREAMEX_BROADCAST_LOAD(_written);
+    if (size > cap)
+    {
+        // Older bytes would be overwritten by this very call; skip them.
+        w    += size - cap;
+        data += size - cap;
+        size  = cap;
+    }
+
+#if defined(__AVR__)
+    { const uint8_t sreg = SREG; cli(); _claimed = w + size; SREG = sreg; }
+#else
+    _claimed.store(w + size, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);   // claim is visible before any byte changes
+#endif
+
+    const uint32_t pos   = w & _mask;
+    const uint32_t first = (size < cap - pos) ? size : cap - pos;
+    memcpy(_storage + pos, data, first);
+    memcpy(_storage, data + first, size - first);
+
+#if defined(__AVR__)
+    { const uint8_t sreg = SREG; cli(); _written = w + size; SREG = sreg; }
+#else
+    _written.store(w + size, std::memory_order_release);
+#endif
+}
+
+void StreamExBroadcast::attach(StreamExBroadcastReader& reader) const
+{
+    reader.cursor = written();
+    reader.lagged = false;
+}
+
+void StreamExBroadcast::_resync(StreamExBroadcastReader& reader, uint32_t written)
+{
+    reader.lost  += written - reader.cursor;
+    reader.cursor = written;
+    reader.lagged = true;
+}
+
+uint32_t StreamExBroadcast::_check(StreamExBroadcastReader& reader, uint32_t written) const
+{
+    // Bytes the writer has started to overwrite count as gone already.
+    const uint32_t claimed = STREAMEX_BROADCAST_LOAD(_claimed);
+    if (claimed - reader.cursor > _mask + 1) { _resync(reader, written); return 0; }
+    return written - reader.cursor;
+}
+
+uint32_t StreamExBroadcast::available(StreamExBroadcastReader& reader) const
+{
+    if (!_storage) return 0;
+    return _check(reader, written());
+}
+
+const char* StreamExBroadcast::peek(StreamExBroadcastReader& reader, uint32_t* size) const
+{
+    if (size) *size = 0;
+    if (!_storage) return nullptr;
+    const uint32_t unread = _check(reader, written());
+    if (unread == 0) return nullptr;
+
+    const uint32_t pos = reader.cursor & _mask;
+    const uint32_t run = _mask + 1 - pos;
+    if (size) *size = (unread < run) ? unread : run;
+    return _storage + pos;
+}
+
+bool StreamExBroadcast::consume(StreamExBroadcastReader& reader, uint32_t size) const
+{
+    if (!_storage) return false;
+    // Validate after use: if the writer claimed past the bytes just read, they may be torn.
+    STREAMEX_BROADCAST_FENCE_ACQUIRE();
+    const uint32_t written = this->written();
+    if (STREAMEX_BROADCAST_LOAD(_claimed) - reader.cursor > _mask + 1) { _resync(reader, written); return false; }
+
+    const uint32_t unread = written - reader.cursor;
+    reader.cursor += (size < unread) ? size : unread;
+    return true;
+}
+
+uint32_t StreamExBroadcast::read(StreamExBroadcastReader& reader, char* out, uint32_t maxSize) const
+{
+    if (!out) return 0;
+    uint32_t done = 0;
+    while (done < maxSize)
+    {
+        uint32_t run;
+        const char* p = peek(reader, &run);
+        if (!p) break;
+        if (run > maxSize - done) run = maxSize - done;
+        memcpy(out + done, p, run);
+        if (!consume(reader, run)) break;   // this run was torn; earlier ones are intact
+        done += run;
+    }
+    return done;
+}
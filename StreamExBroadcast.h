@@ -0,0 +1,130 @@
+#pragma once
+/**
+ * @file StreamExBroadcast.h
+ * @brief Single-writer / multi-reader broadcast ring: received data is written once and read N times.
+ *
+ * @details
+ * The writer (UART driver, ISR or RX thread) appends into one ring and never waits.
+ * Every consumer (logger, parser, forwarder) owns a ::StreamExBroadcastReader cursor
+ * and reads the shared bytes in place:
+ *
+ * @code
+ *   static char ring[4096];
+ *   StreamExBroadcast rx(ring, sizeof(ring));
+ *   StreamExBroadcastReader logger, parser;
+ *   rx.attach(logger);
+ *   rx.attach(parser);
+ *
+ *   rx.write(chunk, n);                          // writer side
+ *
+ *   uint32_t size;                               // each reader, at its own pace
+ *   if (const char* p = rx.peek(parser, &size)) {
+ *     const uint32_t used = parse(p, size);
+ *     if (!rx.consume(parser, used)) { ... }     // overwritten while parsing: discard results
+ *   }
+ *   if (parser.lagged) { resync(); parser.lagged = false; }
+ * @endcode
+ *
+ * A reader that falls more than `capacity()` bytes behind is not waited for: it is
+ * marked `lagged`, the skipped byte count is added to `lost`, and its cursor jumps to
+ * the newest data. Because the writer may overwrite a region while a reader is still
+ * looking at it, `consume()` and `read()` validate afterwards (seqlock style) and
+ * report data that was overwritten during use.
+ *
+ * One writer only; any number of readers, each used by one thread.
+ */
+
+#include <stdint.h>       ///< Fixed-width integer types
+
+#if !defined(__AVR__)
+  #include <atomic>       ///< Write counters
+#endif
+
+/**
+ * @struct StreamExBroadcastReader
+ * @brief One consumer's position in a ::StreamExBroadcast (owned by that consumer).
+ */
+struct StreamExBroadcastReader
+{
+    uint32_t cursor = 0;     ///< Next byte to read (absolute count, wraps).
+    uint32_t lost   = 0;     ///< Bytes skipped because the writer lapped this reader (cumulative).
+    bool     lagged = false; ///< Set on every lap; cleared by the owner after resynchronising.
+};
+
+/**
+ * @class StreamExBroadcast
+ * @brief Wait-free broadcast ring over caller-owned memory.
+ */
+class StreamExBroadcast
+{
+  public:
+
+    /**
+     * @brief Construct over caller-owned memory.
+     * @param storage     Ring memory (must outlive the broadcast).
+     * @param storageSize Size in bytes; rounded down to a power of two.
+     */
+    StreamExBroadcast(char* storage, uint32_t storageSize);
+
+    /**
+     * @brief Append @p size bytes for all readers (writer only; never blocks).
+     * @note If @p size exceeds `capacity()`, only the last `capacity()` bytes are kept.
+     */
+    void write(const char* data, uint32_t size);
+
+    /** @brief Start @p reader at the current end of the data (it sees only newer bytes). */
+    void attach(StreamExBroadcastReader& reader) const;
+
+    /** @brief Bytes @p reader has not read yet (checks for lag first). */
+    uint32_t available(StreamExBroadcastReader& reader) const;
+
+    /**
+     * @brief Unread bytes of @p reader as one contiguous run in the ring (no copy).
+     * @param size Receives the run length (up to the ring end; the rest follows after `consume()`).
+     * @return Run start, or nullptr if nothing is unread.
+     * @warning The writer may overwrite the run while it is in use; `consume()` tells.
+     */
+    const char* peek(StreamExBroadcastReader& reader, uint32_t* size) const;
+
+    /**
+     * @brief Advance @p reader by @p size bytes after using them from `peek()`.
+     * @retval true  The bytes were intact while in use.
+     * @retval false The writer overwrote them meanwhile: @p reader is marked lagged and
+     *               resynchronised; discard whatever was derived from them.
+     */
+    bool consume(StreamExBroadcastReader& reader, uint32_t size) const;
+
+    /**
+     * @brief Copy up to @p maxSize unread bytes to @p out and advance @p reader.
+     * @return Intact bytes copied. A part overwritten during the copy is not counted and
+     *         marks @p reader lagged.
+     */
+    uint32_t read(StreamExBroadcastReader& reader, char* out, uint32_t maxSize) const;
+
+    /** @brief Ring size in bytes (power of two). */
+    uint32_t capacity() const { return _mask + 1; }
+
+    /** @brief Total bytes written since construction (wraps). */
+    uint32_t written() const;
+
+  private:
+
+    char*    _storage;  ///< Caller-owned ring.
+    uint32_t _mask;     ///< Capacity - 1 (capacity is a power of two; 0 storage → 0).
+
+    // `_claimed` moves before a write (announces the bytes about to be overwritten),
+    // `_written` after it (publishes them).
+#if defined(__AVR__)
+    volatile uint32_t        _claimed;
+    volatile uint32_t        _written;
+#else
+    std::atomic<uint32_t>    _claimed;
+    std::atomic<uint32_t>    _written;
+#endif
+
+    /** @brief Mark @p reader lagged if it fell behind; returns its unread byte count. */
+    uint32_t _check(StreamExBroadcastReader& reader, uint32_t written) const;
+
+    /** @brief Jump @p reader to @p written, accounting the skipped bytes. */
+    static void _resync(StreamExBroadcastReader& reader, uint32_t written);
+};
@@ -0,0 +1,202 @@
+/**
+ * @file StreamExChunkPool.cpp
+ * @brief Definitions for the chunk pool and chunk chains.
+ */
+#include "StreamExChunkPool.h"
+
+#include <string.h>     // memcpy
+
+#if defined(__AVR__)
+  #include <avr/interrupt.h>   // cli, SREG
+
+  // Single core, no atomics: a short interrupt-free section is equivalent.
+  namespace {
+    struct CriticalSection {
+      uint8_t sreg;
+      CriticalSection() : sreg(SREG) { cli(); }
+      ~CriticalSection() { SREG = sreg; }
+    };
+  }
+#endif
+
+StreamExChunkPool::StreamExChunkPool(void* storage, uint32_t storageSize, uint16_t chunkSize)
+: _base(static_cast<char*>(storage)), _stride(0), _chunkSize(chunkSize), _chunkCount(0),
+_head(0), _freeCount(0), _minFree(0)
+{
+    if (!storage || chunkSize == 0) return;
+
+    // Keep every header pointer-aligned.
+    const uint32_t align = (uint32_t)sizeof(void*);
+    _stride = ((uint32_t)sizeof(StreamExChunk) + chunkSize + align - 1) / align * align;
+
+    uint32_t count = (storageSize >= _stride) ? storageSize / _stride : 0;
+    if (count > 0xFFFF) count = 0xFFFF;   // index must fit the low half of the head word
+    _chunkCount = count;
+
+    // Thread the free list in address order so the first streams get adjacent chunks.
+    for (uint32_t i = 0; i < count; ++i) _at(i)->next = (i + 1 < count) ? _at(i + 1) : nullptr;
+    _head      = count ? 1u : 0u;
+    _freeCount = count;
+    _minFree   = count;
+}
+
+uint32_t StreamExChunkPool::freeCount() const
+{
+#if defined(__AVR__)
+    CriticalSection cs;
+#endif
+    return _freeCount;
+}
+
+uint32_t StreamExChunkPool::minFreeCount() const
+{
+#if defined(__AVR__)
+    CriticalSection cs;
+#endif
+    return _minFree;
+}
+
+StreamExChunk* StreamExChunkPool::acquire()
+{
+    StreamExChunk* c = nullptr;
+#if defined(__AVR__)
+    {
+        CriticalSection cs;
+        if ((_head & 0xFFFF) == 0) return nullptr;
+        c = _at((_head & 0xFFFF) - 1);
+        _head = c->next ? (uint32_t)((reinterpret_cast<char*>(c->next) - _base) / _stride + 1) : 0;
+        if (--_freeCount < _minFree) _minFree = _freeCount;
+    }
+    c->next = nullptr;
+#else
+    uint32_t head = _head.load(std::memory_order_acquire);
+    for (;;)
+    {
+        const uint32_t idx = head & 0xFFFF;
+        if (idx == 0) return nullptr;
+        c = _at(idx - 1);
+        // c->next may be stale if another thread popped c meanwhile; the tag makes the CAS fail then.
+        const StreamExChunk* next = __atomic_load_n(&c->next, __ATOMIC_RELAXED);
+        const uint32_t nextIdx = next ? (uint32_t)((reinterpret_cast<const char*>(next) - _base) / _stride + 1) : 0;
+        const uint32_t desired = (((head >> 16) + 1) << 16) | nextIdx;
+        if (_head.compare_exchange_weak(head, desired, std::memory_order_acq_rel, std::memory_order_acquire)) break;
+    }
+    const uint32_t left = _freeCount.fetch_sub(1, std::memory_order_relaxed) - 1;
+    uint32_t low = _minFree.load(std::memory_order_relaxed);
+    while (left < low && !_minFree.compare_exchange_weak(low, left, std::memory_order_relaxed)) {}
+    __atomic_store_n(&c->next, (StreamExChunk*)nullptr, __ATOMIC_RELAXED);
+#endif
+    c->begin = 0;
+    c->end   = 0;
+    return c;
+}
+
+void StreamExChunkPool::release(StreamExChunk* chunk)
+{
+    if (!chunk) return;
+    const uint32_t idx = (uint32_t)((reinterpret_cast<char*>(chunk) - _base) / _stride + 1);
+#if defined(__AVR__)
+    CriticalSection cs;
+    chunk->next = (_head & 0xFFFF) ? _at((_head & 0xFFFF) - 1) : nullptr;
+    _head = idx;
+    ++_freeCount;
+#else
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        __atomic_store_n(&chunk->next, (head & 0xFFFF) ? _at((head & 0xFFFF) - 1) : (StreamExChunk*)nullptr, __ATOMIC_RELAXED);
+        const uint32_t desired = (((head >> 16) + 1) << 16) | idx;
+        if (_head.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed)) break;
+    }
+    _freeCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+// ---------------- StreamExChunkQueue ----------------
+
+uint32_t StreamExChunkQueue::append(StreamExChunkPool& pool, const char* data, uint32_t dataSize, uint16_t maxChunks)
+{
+    uint32_t done = 0;
+    while (done < dataSize)
+    {
+        if (!tail || tail->end == pool.chunkSize())
+        {
+            if (maxChunks && chunks >= maxChunks) break;
+            StreamExChunk* c = pool.acquire();
+            if (!c) break;
+            // A stale acquire() elsewhere may still load tail->next: store it atomically.
+#if defined(__AVR__)
+            if (tail) tail->next = c; else head = c;
+#else
+            if (tail) __atomic_store_n(&tail->next, c, __ATOMIC_RELAXED); else head = c;
+#endif
+            tail = c;
+            ++chunks;
+        }
+        uint32_t n = (uint32_t)(pool.chunkSize() - tail->end);
+        if (n > dataSize - done) n = dataSize - done;
+        memcpy(tail->data() + tail->end, data + done, n);
+        tail->end = (uint16_t)(tail->end + n);
+        done += n;
+    }
+    size += done;
+    return done;
+}
+
+uint32_t StreamExChunkQueue::peek(char* out, uint32_t dataSize) const
+{
+    uint32_t done = 0;
+    for (const StreamExChunk* c = head; c && done < dataSize; c = c->next)
+    {
+        uint32_t n = (uint32_t)(c->end - c->begin);
+        if (n > dataSize - done) n = dataSize - done;
+        memcpy(out + done, c->data() + c->begin, n);
+        done += n;
+    }
+    return done;
+}
+
+uint32_t StreamExChunkQueue::drop(StreamExChunkPool& pool, uint32_t dataSize)
+{
+    uint32_t done = 0;
+    while (head && done < dataSize)
+    {
+        uint32_t n = (uint32_t)(head->end - head->begin);
+        if (n > dataSize - done) n = dataSize - done;
+        head->begin = (uint16_t)(head->begin + n);
+        done += n;
+
+        // Hand drained chunks back at once; a drained tail is recycled too so an
+        // idle stream holds no chunks.
+        if (head->begin == head->end)
+        {
+            StreamExChunk* next = head->next;
+            if (head == tail) tail = nullptr;
+            pool.release(head);
+            head = next;
+            --chunks;
+        }
+    }
+    size -= done;
+    return done;
+}
+
+void StreamExChunkQueue::clear(StreamExChunkPool& pool)
+{
+    while (head)
+    {
+        StreamExChunk* next = head->next;
+        pool.release(head);
+        head = next;
+    }
+    tail   = nullptr;
+    size   = 0;
+    chunks = 0;
+}
+
+uint32_t StreamExChunkQueue::room(const StreamExChunkPool& pool, uint16_t maxChunks) const
+{
+    uint32_t more = pool.freeCount();
+    if (maxChunks) more = (chunks >= maxChunks) ? 0 : ((uint32_t)(maxChunks - chunks) < more ? (uint32_t)(maxChunks - chunks) : more);
+    return tailRoom(pool) + more * pool.chunkSize();
+}
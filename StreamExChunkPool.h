@@ -0,0 +1,161 @@
+#pragma once
+/**
+ * @file StreamExChunkPool.h
+ * @brief Fixed-size chunk pool and chunk chains for the segmented ::StreamEx buffer mode.
+ *
+ * @details
+ * A ::StreamExChunkPool carves caller-provided memory into equal chunks. A
+ * ::StreamExChunkQueue strings chunks together into a FIFO: appends fill the tail
+ * chunk and take a new one from the pool when it is full, reads consume from the
+ * head chunk and hand it back as soon as it is drained. No byte is ever moved
+ * after it was written, and one pool can back any number of streams, so RAM
+ * scales with the aggregate backlog rather than stream count × peak:
+ *
+ * @code
+ *   static uint8_t poolMemory[32 * (sizeof(StreamExChunk) + 64)];
+ *   StreamExChunkPool pool(poolMemory, sizeof(poolMemory), 64);
+ *
+ *   StreamEx a, b;
+ *   a.setTxPool(&pool, 8);   // at most 8 chunks (512 bytes) queued on a
+ *   b.setTxPool(&pool);      // no quota
+ *   b.setRxPool(&pool, 4);
+ * @endcode
+ *
+ * `acquire()`/`release()` are lock-free (a tagged Treiber stack on one 32-bit
+ * atomic word), so streams driven from different threads or from interrupts may
+ * share a pool. On AVR, which has no atomics, they briefly disable interrupts.
+ * A single stream is still not thread-safe.
+ */
+
+#include <stdint.h>       ///< Fixed-width integer types
+#include <stddef.h>       ///< size_t
+
+#if !defined(__AVR__)
+  #include <atomic>       ///< Lock-free free list
+#endif
+
+/**
+ * @struct StreamExChunk
+ * @brief Chunk header; `chunkSize` payload bytes follow it in memory.
+ */
+struct StreamExChunk
+{
+    StreamExChunk* next;   ///< Next chunk in the chain (or free list).
+    uint16_t       begin;  ///< First unread payload byte.
+    uint16_t       end;    ///< One past the last written payload byte.
+
+    /** @brief Payload bytes (directly after the header). */
+    char* data() { return reinterpret_cast<char*>(this + 1); }
+    /** @brief Payload bytes (directly after the header). */
+    const char* data() const { return reinterpret_cast<const char*>(this + 1); }
+};
+
+/**
+ * @class StreamExChunkPool
+ * @brief Free list of equally sized chunks in caller-owned memory.
+ *
+ * The pool does not own @p storage; it must outlive every stream using the pool.
+ */
+class StreamExChunkPool
+{
+  public:
+
+    /**
+     * @brief Carve @p storageSize bytes into chunks of @p chunkSize payload bytes.
+     * @param storage     Caller-owned memory (pointer-aligned).
+     * @param storageSize Size of @p storage in bytes.
+     * @param chunkSize   Payload bytes per chunk (header not included).
+     *
+     * Each chunk occupies `sizeof(StreamExChunk) + chunkSize` bytes rounded up to
+     * pointer alignment; the remainder of @p storage is unused.
+     */
+    StreamExChunkPool(void* storage, uint32_t storageSize, uint16_t chunkSize);
+
+    /**
+     * @brief Take a chunk from the pool (lock-free).
+     * @return An empty chunk, or nullptr if the pool is exhausted.
+     */
+    StreamExChunk* acquire();
+
+    /** @brief Return a chunk to the pool (lock-free; nullptr is ignored). */
+    void release(StreamExChunk* chunk);
+
+    /** @brief Payload bytes per chunk. */
+    uint16_t chunkSize() const { return _chunkSize; }
+    /** @brief Total number of chunks (at most 65535). */
+    uint32_t chunkCount() const { return _chunkCount; }
+    /** @brief Number of chunks currently in the pool (a snapshot under concurrency). */
+    uint32_t freeCount() const;
+    /** @brief Lowest `freeCount()` seen since construction (sizing aid). */
+    uint32_t minFreeCount() const;
+
+  private:
+
+    char*          _base;        ///< First chunk.
+    uint32_t       _stride;      ///< Bytes from one chunk to the next.
+    uint16_t       _chunkSize;   ///< Payload bytes per chunk.
+    uint32_t       _chunkCount;  ///< Chunks carved from storage.
+
+    // Free-list head packs (ABA tag << 16) | (chunk index + 1); 0 in the low half = empty.
+#if defined(__AVR__)
+    uint32_t                 _head;
+    uint32_t                 _freeCount;
+    uint32_t                 _minFree;
+#else
+    std::atomic<uint32_t>    _head;
+    std::atomic<uint32_t>    _freeCount;
+    std::atomic<uint32_t>    _minFree;
+#endif
+
+    /** @brief Chunk at index @p i. */
+    StreamExChunk* _at(uint32_t i) const { return reinterpret_cast<StreamExChunk*>(_base + i * _stride); }
+};
+
+/**
+ * @struct StreamExChunkQueue
+ * @brief FIFO of bytes stored in a chain of pool chunks.
+ *
+ * Plain aggregate (no constructor) so it can live inside ::StreamEx; start from
+ * `{nullptr, nullptr, 0, 0}` and always pass the same pool.
+ */
+struct StreamExChunkQueue
+{
+    StreamExChunk* head;   ///< Oldest chunk (read side).
+    StreamExChunk* tail;   ///< Newest chunk (write side).
+    uint32_t       size;   ///< Bytes stored.
+    uint16_t       chunks; ///< Chunks held.
+
+    /**
+     * @brief Append up to @p dataSize bytes, taking chunks from @p pool as needed.
+     * @param maxChunks Quota: never hold more than this many chunks (0 = unlimited).
+     * @return Number of bytes stored (less than @p dataSize when the pool or quota runs dry).
+     */
+    uint32_t append(StreamExChunkPool& pool, const char* data, uint32_t dataSize, uint16_t maxChunks = 0);
+
+    /**
+     * @brief Copy up to @p dataSize bytes from the front without consuming them.
+     * @return Number of bytes copied.
+     */
+    uint32_t peek(char* out, uint32_t dataSize) const;
+
+    /**
+     * @brief Drop @p dataSize bytes from the front, returning drained chunks to @p pool.
+     * @return Number of bytes dropped.
+     */
+    uint32_t drop(StreamExChunkPool& pool, uint32_t dataSize);
+
+    /** @brief Return every chunk to @p pool. */
+    void clear(StreamExChunkPool& pool);
+
+    /** @brief Contiguous bytes readable at `front()`. */
+    uint32_t frontSize() const { return head ? (uint32_t)(head->end - head->begin) : 0; }
+
+    /** @brief First unread byte (valid for `frontSize()` bytes), or nullptr if empty. */
+    const char* front() const { return head ? head->data() + head->begin : nullptr; }
+
+    /** @brief Bytes that fit without a new chunk. */
+    uint32_t tailRoom(const StreamExChunkPool& pool) const { return tail ? (uint32_t)(pool.chunkSize() - tail->end) : 0; }
+
+    /** @brief Bytes that can still be appended under @p maxChunks (0 = unlimited) with the pool as it is now. */
+    uint32_t room(const StreamExChunkPool& pool, uint16_t maxChunks = 0) const;
+};
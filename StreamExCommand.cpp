@@ -0,0 +1,143 @@
+/**
+ * @file StreamExCommand.cpp
+ * @brief Definitions for the `KEY=VALUE` perfect-hash command registry.
+ */
+#include "StreamExCommand.h"
+
+#include <string.h>     // memcpy, memset, memchr
+
+StreamExCommandTable::StreamExCommandTable(const StreamExCommand* commands, uint8_t commandCount,
+                                           uint8_t* slots, uint8_t slotCount)
+: errorCode(StreamExCommandError::None),
+_commands(commands), _slots(slots),
+_commandCount(commandCount), _slotCount(slotCount),
+_seed(0), _built(false)
+{
+}
+
+uint8_t StreamExCommandTable::_slotOf(uint32_t hash) const
+{
+    // Mix the seed in multiplicatively, fold the high half into the low half, then reduce
+    // modulo the slot count (no 64-bit multiply, which is costly on AVR).
+    uint32_t h = (hash ^ ((uint32_t)_seed * 0x9E3779B9UL)) * 0x85EBCA6BUL;
+    h ^= h >> 16;
+    return (uint8_t)(h % _slotCount);
+}
+
+bool StreamExCommandTable::begin()
+{
+    _built = false;
+    if (!_commands || !_slots || _slotCount < _commandCount || _slotCount == 0) {
+        errorCode = StreamExCommandError::BuildFailed; return false;
+    }
+
+    // Duplicate keys can never be separated by a seed.
+    for (uint8_t i = 0; i < _commandCount; ++i)
+        for (uint8_t j = i + 1; j < _commandCount; ++j)
+            if (_commands[i].hash == _commands[j].hash &&
+                StreamEx_utility::iequal(_commands[i].key, _commands[j].key)) {
+                errorCode = StreamExCommandError::BuildFailed; return false;
+            }
+
+    for (uint16_t s = 0; s < 256; ++s)
+    {
+        _seed = (uint8_t)s;
+        memset(_slots, 0, _slotCount);
+        bool ok = true;
+        for (uint8_t i = 0; i < _commandCount && ok; ++i)
+        {
+            uint8_t& slot = _slots[_slotOf(_commands[i].hash)];
+            if (slot) ok = false;
+            else slot = (uint8_t)(i + 1);
+        }
+        if (ok) { _built = true; errorCode = StreamExCommandError::None; return true; }
+    }
+
+    errorCode = StreamExCommandError::BuildFailed;
+    return false;
+}
+
+const StreamExCommand* StreamExCommandTable::find(const char* key, uint32_t keySize) const
+{
+    if (!_built || !key) return nullptr;
+    const uint8_t slot = _slots[_slotOf(StreamEx_utility::ihashN(key, keySize))];
+    if (!slot) return nullptr;
+    const StreamExCommand& cmd = _commands[slot - 1];
+    // One comparison confirms the key (the slot may belong to a different key).
+    if (StreamEx_utility::safe_strnlen(cmd.key, keySize + 1) != keySize) return nullptr;
+    return StreamEx_utility::iequalN(cmd.key, key, keySize) ? &cmd : nullptr;
+}
+
+void StreamExCommandTable::_store(const StreamExCommand& cmd, const dataValue& value)
+{
+    if (!cmd.target) return;
+    if (cmd.type == stringType)
+    {
+        const uint32_t cap = cmd.targetSize ? cmd.targetSize : STREAMEX_STRING_CAP;
+        const uint32_t size = value.stringSize();
+        const uint32_t n = (size < cap) ? size : (cap - 1);
+        memcpy(cmd.target, value.stringData(), n);
+        static_cast<char*>(cmd.target)[n] = '\0';
+        return;
+    }
+    dataValueUnion u;
+    value.toUnion(&u);
+    memcpy(cmd.target, &u, StreamEx_utility::dataTypeSize(cmd.type));
+}
+
+bool StreamExCommandTable::dispatch(const char* line, uint32_t lineSize)
+{
+    if (!_built) { errorCode = StreamExCommandError::NotBuilt; return false; }
+    if (!line)   { errorCode = StreamExCommandError::NoDelimiter; return false; }
+
+    if (lineSize && line[lineSize - 1] == '\r') --lineSize;
+
+    const char* eq = static_cast<const char*>(memchr(line, '=', lineSize));
+    if (!eq) { errorCode = StreamExCommandError::NoDelimiter; return false; }
+
+    // Trim spaces around key and value in place (views only).
+    const char* k = line;
+    const char* kEnd = eq;
+    while (k < kEnd && (*k == ' ' || *k == '\t')) ++k;
+    while (kEnd > k && (kEnd[-1] == ' ' || kEnd[-1] == '\t')) --kEnd;
+
+    const char* v = eq + 1;
+    const char* vEnd = line + lineSize;
+    while (v < vEnd && (*v == ' ' || *v == '\t')) ++v;
+    while (vEnd > v && (vEnd[-1] == ' ' || vEnd[-1] == '\t')) --vEnd;
+
+    const StreamExCommand* cmd = find(k, (uint32_t)(kEnd - k));
+    if (!cmd) { errorCode = StreamExCommandError::UnknownKey; return false; }
+
+    dataValue value;
+    if (!StreamEx_utility::stringToValue(v, (uint32_t)(vEnd - v), &value, cmd->type)) {
+        errorCode = StreamExCommandError::InvalidValue; return false;
+    }
+
+    _store(*cmd, value);
+    if (cmd->handler) cmd->handler(value, cmd->context);
+    return true;
+}
+
+uint32_t StreamExCommandTable::process(StreamEx& stream, char terminator)
+{
+    stream.available();   // DMA ring: sync and mirror wrapped bytes before scanning
+    const char* buf = stream.getRxBuffer();
+    const uint32_t avail = stream.availableRxContiguous();
+    if (!buf || avail == 0) return 0;
+
+    uint32_t consumed = 0;
+    uint32_t ok = 0;
+    for (;;)
+    {
+        const char* nl = static_cast<const char*>(memchr(buf + consumed, terminator, avail - consumed));
+        if (!nl) break;
+        const uint32_t lineSize = (uint32_t)(nl - (buf + consumed));
+        if (lineSize && dispatch(buf + consumed, lineSize)) ++ok;
+        consumed += lineSize + 1;
+    }
+
+    // Single compaction for all consumed lines.
+    if (consumed) stream.removeFrontRxBuffer(consumed);
+    return ok;
+}
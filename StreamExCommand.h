@@ -0,0 +1,156 @@
+#pragma once
+/**
+ * @file StreamExCommand.h
+ * @brief `KEY=VALUE` command registry with perfect-hash key lookup for ::StreamEx.
+ *
+ * @details
+ * A ::StreamExCommandTable binds protocol keys to a ::dataTypeEnum and a target
+ * variable and/or handler. Each line is split, looked up and converted in a single
+ * pass over the caller's memory (no intermediate string copies):
+ *
+ * @code
+ *   float    gain;
+ *   uint16_t rate;
+ *   static const StreamExCommand cmds[] = {
+ *       StreamExCommand("GAIN", floatType,  &gain),
+ *       StreamExCommand("RATE", uint16Type, &rate),
+ *   };
+ *   static uint8_t slots[4];
+ *   StreamExCommandTable table(cmds, 2, slots, sizeof(slots));
+ *
+ *   table.begin();              // once, in setup()
+ *   table.process(myStream);    // in loop(): dispatches every complete RX line
+ * @endcode
+ *
+ * Key hashes are computed at compile time by the constexpr ::StreamExCommand
+ * constructor. `begin()` then searches a seed that maps every key to a distinct
+ * slot (a perfect hash), so a lookup costs one hash and one key comparison,
+ * independent of the number of commands.
+ */
+
+#include "StreamEx.h"
+
+/**
+ * @brief Optional per-command callback.
+ * @param value   Parsed value; ::stringType values are views into the caller's line.
+ * @param context User pointer registered with the command.
+ */
+typedef void (*StreamExCommandHandler)(const dataValue& value, void* context);
+
+/**
+ * @struct StreamExCommand
+ * @brief One registry entry: key, value type, and where the converted value goes.
+ */
+struct StreamExCommand
+{
+    const char*            key;        ///< Command key (NUL-terminated, matched case-insensitively).
+    uint32_t               hash;       ///< `StreamEx_utility::ihash(key)`, computed at compile time.
+    dataTypeEnum           type;       ///< Expected value type.
+    void*                  target;     ///< Variable receiving the value (nullable).
+    uint32_t               targetSize; ///< Capacity of @p target for ::stringType (0 → STREAMEX_STRING_CAP).
+    StreamExCommandHandler handler;    ///< Callback invoked after conversion (nullable).
+    void*                  context;    ///< User pointer passed to @p handler.
+
+    /**
+     * @brief Build an entry; the key hash is evaluated at compile time for literal keys.
+     * @param k          Command key literal.
+     * @param t          Expected value type.
+     * @param tgt        Target variable of type @p t (or char buffer for ::stringType).
+     * @param tgtSize    Target capacity for ::stringType (0 → STREAMEX_STRING_CAP).
+     * @param h          Optional handler.
+     * @param ctx        Optional handler context.
+     */
+    constexpr StreamExCommand(const char* k, dataTypeEnum t, void* tgt = nullptr, uint32_t tgtSize = 0,
+                              StreamExCommandHandler h = nullptr, void* ctx = nullptr)
+    : key(k), hash(StreamEx_utility::ihash(k)), type(t), target(tgt), targetSize(tgtSize),
+      handler(h), context(ctx) {}
+};
+
+/**
+ * @enum StreamExCommandError
+ * @brief Error/status codes reported by ::StreamExCommandTable.
+ */
+enum class StreamExCommandError : int8_t
+{
+  None = 0,      ///< No error
+  NotBuilt,      ///< `begin()` was not called or failed
+  BuildFailed,   ///< Duplicate keys or too few slots to build a perfect hash
+  NoDelimiter,   ///< Line has no `=` separator
+  UnknownKey,    ///< Key is not registered
+  InvalidValue   ///< Value failed validation for the command's type
+};
+
+/**
+ * @class StreamExCommandTable
+ * @brief Perfect-hash dispatcher for `KEY=VALUE` lines.
+ *
+ * The table does not own the command array or the slot array; both must outlive it.
+ */
+class StreamExCommandTable
+{
+  public:
+
+    /** @brief Last error recorded by any API call. */
+    StreamExCommandError errorCode;
+
+    /**
+     * @brief Construct a table over caller-provided storage.
+     * @param commands     Array of entries (must outlive the table).
+     * @param commandCount Number of entries in @p commands (max 255).
+     * @param slots        Scratch array used as the hash table (must outlive the table).
+     * @param slotCount    Number of slots; must be ≥ @p commandCount. About 2× gives fast builds.
+     */
+    StreamExCommandTable(const StreamExCommand* commands, uint8_t commandCount, uint8_t* slots, uint8_t slotCount);
+
+    /**
+     * @brief Build the perfect hash (call once after construction).
+     * @retval true  Every key maps to its own slot.
+     * @retval false Duplicate key or no seed found (sets ::StreamExCommandError::BuildFailed).
+     */
+    bool begin();
+
+    /**
+     * @brief Look up a key.
+     * @param key     Pointer to key characters (not necessarily NUL-terminated).
+     * @param keySize Number of characters in @p key.
+     * @return Matching entry, or nullptr if not registered.
+     */
+    const StreamExCommand* find(const char* key, uint32_t keySize) const;
+
+    /**
+     * @brief Parse and apply one `KEY=VALUE` line.
+     * @param line     Pointer to the line (not necessarily NUL-terminated; trailing `\r` ignored).
+     * @param lineSize Length of @p line in bytes.
+     * @retval true  Value converted, stored into the target and handler called.
+     * @retval false See ::errorCode.
+     *
+     * @note Spaces around the key and the value are ignored.
+     */
+    bool dispatch(const char* line, uint32_t lineSize);
+
+    /**
+     * @brief Dispatch every complete line currently buffered in @p stream's RX.
+     * @param stream     Source stream; consumed lines are removed from RX in one step.
+     * @param terminator Line terminator.
+     * @return Number of lines dispatched successfully. ::errorCode holds the last failure.
+     */
+    uint32_t process(StreamEx& stream, char terminator = '\n');
+
+    /** @brief Seed selected by `begin()` (useful to hard-code in diagnostics). */
+    uint8_t seed() const { return _seed; }
+
+  private:
+
+    const StreamExCommand* _commands;     ///< Caller-owned command entries.
+    uint8_t*               _slots;        ///< Caller-owned hash table (entry index + 1; 0 = empty).
+    uint8_t                _commandCount; ///< Number of entries.
+    uint8_t                _slotCount;    ///< Number of slots.
+    uint8_t                _seed;         ///< Perfect-hash seed.
+    bool                   _built;        ///< true after a successful `begin()`.
+
+    /** @brief Slot index of @p hash for the current seed. */
+    uint8_t _slotOf(uint32_t hash) const;
+
+    /** @brief Store @p value into @p cmd's target. */
+    static void _store(const StreamExCommand& cmd, const dataValue& value);
+};
@@ -0,0 +1,36 @@
+/**
+ * @file StreamExMessage.cpp
+ * @brief Definitions for the arena-backed message builder.
+ */
+#include "StreamExMessage.h"
+
+StreamExMessageBuilder::StreamExMessageBuilder(char* arena, uint32_t arenaSize)
+: errorCode(StreamExMessageError::None),
+_arena(arena), _arenaSize(arena ? arenaSize : 0), _used(0)
+{
+}
+
+StreamExMessageBuilder& StreamExMessageBuilder::appendFixed(int32_t value, uint8_t fracBits, uint8_t decimals)
+{
+    if (errorCode != StreamExMessageError::ArenaFull)
+        _advance(StreamEx_utility::formatFixed(_arena + _used, _room(), value, fracBits, decimals));
+    return *this;
+}
+
+StreamExMessageBuilder& StreamExMessageBuilder::appendHexDump(const uint8_t* data, uint32_t size)
+{
+    if (!data) size = 0;
+    if (_reserve(2 * size))
+        _used += (uint32_t)StreamEx_utility::hexEncode(_arena + _used, _room(), data, size);
+    return *this;
+}
+
+bool StreamExMessageBuilder::commit(StreamEx& stream)
+{
+    if (errorCode == StreamExMessageError::ArenaFull) return false;
+    if (stream.freeTx() < _used) { errorCode = StreamExMessageError::TxFull; return false; }
+
+    if (_used) stream.pushBackTxBuffer(_arena, _used);
+    reset();
+    return true;
+}
@@ -0,0 +1,171 @@
+#pragma once
+/**
+ * @file StreamExMessage.h
+ * @brief Arena-backed message builder that publishes to ::StreamEx TX in one commit.
+ *
+ * @details
+ * Composing a message with many `pushBackTxBuffer()` calls pays a capacity check,
+ * a possible `_dropFrontTx()` and a NUL re-termination per fragment. A
+ * ::StreamExMessageBuilder instead bumps a cursor through caller-owned memory:
+ * every append is a bounds check plus a copy or an in-place format, errors are
+ * sticky (checked once), and `commit()` hands the whole message to TX at once:
+ *
+ * @code
+ *   static char arena[128];
+ *   StreamExMessageBuilder msg(arena, sizeof(arena));
+ *
+ *   msg.field("TEMP", 21.5f).field("RPM", (uint16_t)1200).append("OK\n");
+ *   if (!msg.commit(link)) { ... }   // nothing was written; retry later or reset()
+ * @endcode
+ *
+ * Numbers use the `StreamEx_utility::format<T>()` family, so the text matches
+ * what `StreamEx_utility::parse<T>()` and ::StreamExCommandTable accept.
+ */
+
+#include "StreamEx.h"
+
+/**
+ * @enum StreamExMessageError
+ * @brief Error/status codes reported by ::StreamExMessageBuilder.
+ */
+enum class StreamExMessageError : int8_t
+{
+  None = 0,   ///< No error
+  ArenaFull,  ///< An append did not fit; the message is incomplete (sticky until `reset()`)
+  TxFull      ///< `commit()` found too little TX space; the message is kept
+};
+
+/**
+ * @class StreamExMessageBuilder
+ * @brief Bump-pointer text builder over caller-provided memory.
+ *
+ * One byte of the arena is kept for a terminating NUL so in-place formatting never
+ * writes past the end; `data()` is not NUL-terminated in general.
+ */
+class StreamExMessageBuilder
+{
+  public:
+
+    /** @brief Last error recorded by any API call. */
+    StreamExMessageError errorCode;
+
+    /**
+     * @brief Construct a builder over caller-owned memory.
+     * @param arena     Storage (must outlive the builder).
+     * @param arenaSize Size of @p arena in bytes (messages hold up to `arenaSize - 1` bytes).
+     */
+    StreamExMessageBuilder(char* arena, uint32_t arenaSize);
+
+    /** @brief Append @p size raw bytes. */
+    StreamExMessageBuilder& append(const char* data, uint32_t size)
+    {
+        if (_reserve(size)) { memcpy(_arena + _used, data, size); _used += size; }
+        return *this;
+    }
+
+    /** @brief Append a NUL-terminated string. */
+    StreamExMessageBuilder& append(const char* text) { return append(text, text ? (uint32_t)strlen(text) : 0); }
+
+    /** @brief Append a NUL-terminated string (mutable buffers, e.g. a `char[]` field value). */
+    StreamExMessageBuilder& append(char* text) { return append(static_cast<const char*>(text)); }
+
+    /** @brief Append one character. */
+    StreamExMessageBuilder& append(char c)
+    {
+        if (_reserve(1)) _arena[_used++] = c;
+        return *this;
+    }
+
+    /**
+     * @brief Append a number or bool as text, formatted in place.
+     * @tparam T Any integer type, float, double or bool (see `StreamEx_utility::FormatAs`).
+     */
+    template <typename T>
+    StreamExMessageBuilder& append(T value)
+    {
+        typedef typename StreamEx_utility::FormatAs<T>::type U;
+        if (errorCode != StreamExMessageError::ArenaFull)
+            _advance(StreamEx_utility::format<U>(_arena + _used, _room(), (U)value));
+        return *this;
+    }
+
+    /** @brief Append a fixed-point value (see `StreamEx_utility::formatFixed()`). */
+    StreamExMessageBuilder& appendFixed(int32_t value, uint8_t fracBits, uint8_t decimals);
+
+    /** @brief Append an integer as uppercase hex (see `StreamEx_utility::formatHex()`). */
+    template <typename T>
+    StreamExMessageBuilder& appendHex(T value, bool prefix = false)
+    {
+        if (errorCode != StreamExMessageError::ArenaFull)
+            _advance(StreamEx_utility::formatHex<T>(_arena + _used, _room(), value, prefix));
+        return *this;
+    }
+
+    /** @brief Append @p size bytes as a hex dump ("DEADBEEF"). */
+    StreamExMessageBuilder& appendHexDump(const uint8_t* data, uint32_t size);
+
+    /**
+     * @brief Append a `KEY=VALUE` line (the format ::StreamExCommandTable parses).
+     * @param key        Key text.
+     * @param value      Value (string, char or any `format<T>()` type).
+     * @param terminator Line terminator.
+     */
+    template <typename T>
+    StreamExMessageBuilder& field(const char* key, T value, char terminator = '\n')
+    {
+        return append(key).append('=').append(value).append(terminator);
+    }
+
+    /**
+     * @brief Publish the message to @p stream's TX in one bulk append, then `reset()`.
+     * @retval true  Whole message queued.
+     * @retval false ::StreamExMessageError::ArenaFull (message incomplete, not sent) or
+     *               ::StreamExMessageError::TxFull (not enough TX space; message kept for a retry).
+     */
+    bool commit(StreamEx& stream);
+
+    /** @brief Discard the message and clear errors (O(1)). */
+    void reset() { _used = 0; errorCode = StreamExMessageError::None; }
+
+    /** @brief Current length, usable with `rewind()` to drop a partly built section. */
+    uint32_t mark() const { return _used; }
+
+    /** @brief Truncate the message back to @p position (from `mark()`) and clear ::StreamExMessageError::ArenaFull. */
+    void rewind(uint32_t position)
+    {
+        if (position < _used) _used = position;
+        if (errorCode == StreamExMessageError::ArenaFull) errorCode = StreamExMessageError::None;
+    }
+
+    /** @brief Message bytes (not NUL-terminated). */
+    const char* data() const { return _arena; }
+    /** @brief Message length in bytes. */
+    uint32_t size() const { return _used; }
+    /** @brief Largest message the arena can hold. */
+    uint32_t capacity() const { return _arenaSize ? _arenaSize - 1 : 0; }
+
+  private:
+
+    char*    _arena;      ///< Caller-owned storage.
+    uint32_t _arenaSize;  ///< Size of @p _arena.
+    uint32_t _used;       ///< Bump cursor.
+
+    /** @brief Capacity passed to in-place formatters (free bytes + the reserved NUL). */
+    uint32_t _room() const { return _arenaSize - _used; }
+
+    /** @brief Check that @p size more bytes fit; sets the sticky error otherwise. */
+    bool _reserve(uint32_t size)
+    {
+        if (errorCode == StreamExMessageError::ArenaFull) return false;
+        if (size < _room()) return true;
+        errorCode = StreamExMessageError::ArenaFull;
+        return false;
+    }
+
+    /** @brief Accept @p written bytes from an in-place formatter (truncated output → sticky error). */
+    void _advance(size_t written)
+    {
+        if (written < _room()) _used += (uint32_t)written;
+        else errorCode = StreamExMessageError::ArenaFull;
+    }
+};
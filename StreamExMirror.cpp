@@ -0,0 +1,64 @@
+/**
+ * @file StreamExMirror.cpp
+ * @brief Definitions for the mirrored ring mapping (Linux only).
+ */
+#include "StreamExMirror.h"
+
+#if defined(__linux__)
+
+#include <sys/mman.h>     // mmap, munmap
+#include <sys/syscall.h>  // SYS_memfd_create
+#include <unistd.h>       // ftruncate, close, sysconf, syscall
+
+namespace {
+  // Called through syscall() so older C libraries without the wrapper still work.
+  int createMemfd()
+  {
+#if defined(SYS_memfd_create)
+    return (int)syscall(SYS_memfd_create, "StreamExMirror", 1u /* MFD_CLOEXEC */);
+#else
+    return -1;
+#endif
+  }
+}
+
+StreamExMirrorRing::StreamExMirrorRing(size_t minSize)
+: errorCode(StreamExMirrorError::None), _base(nullptr), _size(0)
+{
+    const size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t size = (minSize + page - 1) / page * page;
+    if (minSize == 0 || size > 0x80000000UL) { errorCode = StreamExMirrorError::BadSize; return; }
+
+    const int fd = createMemfd();
+    if (fd < 0 || ftruncate(fd, (off_t)size) != 0)
+    {
+        if (fd >= 0) close(fd);
+        errorCode = StreamExMirrorError::NoMemfd;
+        return;
+    }
+
+    // Reserve both views at once so nothing else can land between them, then
+    // map the same file over each half.
+    void* range = mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    char* base  = (range == MAP_FAILED) ? nullptr : static_cast<char*>(range);
+    const bool ok = base &&
+        mmap(base,        size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+        mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED;
+    close(fd);   // the mappings keep the pages alive
+
+    if (!ok)
+    {
+        if (base) munmap(base, 2 * size);
+        errorCode = StreamExMirrorError::NoMapping;
+        return;
+    }
+    _base = base;
+    _size = (uint32_t)size;
+}
+
+StreamExMirrorRing::~StreamExMirrorRing()
+{
+    if (_base) munmap(_base, 2 * (size_t)_size);
+}
+
+#endif // __linux__
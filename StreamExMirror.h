@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file StreamExMirror.h
+ * @brief Virtual-memory mirrored ring storage for ::StreamEx (Linux hosts only).
+ *
+ * @details
+ * A ::StreamExMirrorRing maps the same physical pages twice, back to back
+ * (`memfd_create()` + two `mmap()` calls into one reserved range). Byte `i` and
+ * byte `i + size()` are the same memory, so any run of up to `size()` bytes that
+ * starts inside the first copy is contiguous, wherever it wraps.
+ *
+ * Handed to `StreamEx::setTxMirror()` / `setRxMirror()`, the stream keeps its
+ * linear-buffer code paths (one `memcpy` per append, flat views for parsers,
+ * single `read()`/`write()` syscalls) while consuming data becomes an O(1)
+ * pointer update instead of a `memmove`:
+ *
+ * @code
+ *   StreamExMirrorRing rxRing(4UL << 20);          // rounded up to whole pages
+ *   if (!rxRing.valid()) { ... }
+ *   link.setRxMirror(rxRing.data(), rxRing.size());
+ *
+ *   const uint32_t room = link.largestFreeRx();
+ *   const ssize_t got = ::read(fd, link.reserveRx(room), room);   // never split
+ *   if (got > 0) link.commitRx((uint32_t)got);
+ * @endcode
+ *
+ * On other platforms this header declares nothing.
+ */
+
+#include <stdint.h>       ///< Fixed-width integer types
+#include <stddef.h>       ///< size_t
+
+#if defined(__linux__)
+
+/**
+ * @enum StreamExMirrorError
+ * @brief Reason a ::StreamExMirrorRing could not be set up.
+ */
+enum class StreamExMirrorError : int8_t
+{
+  None = 0,   ///< Mapping is valid
+  BadSize,    ///< Zero, or larger than 2 GiB after page rounding
+  NoMemfd,    ///< `memfd_create()` or `ftruncate()` failed (see `errno`)
+  NoMapping   ///< Reserving or mapping the address range failed (see `errno`)
+};
+
+/**
+ * @class StreamExMirrorRing
+ * @brief Owns a `2 × size()` address range whose halves alias the same pages.
+ *
+ * Unlike the rest of the library this object owns its memory (the mapping is
+ * released in the destructor); it must outlive any stream using it. Not copyable.
+ */
+class StreamExMirrorRing
+{
+  public:
+
+    /** @brief Setup result. */
+    StreamExMirrorError errorCode;
+
+    /**
+     * @brief Create the mirrored mapping.
+     * @param minSize Requested size in bytes; rounded up to a whole number of pages.
+     */
+    explicit StreamExMirrorRing(size_t minSize);
+
+    /** @brief Unmap both views. */
+    ~StreamExMirrorRing();
+
+    StreamExMirrorRing(const StreamExMirrorRing&) = delete;
+    StreamExMirrorRing& operator=(const StreamExMirrorRing&) = delete;
+
+    /** @brief true if the mapping was created. */
+    bool valid() const { return _base != nullptr; }
+
+    /** @brief Start of the first view (nullptr if not valid); `data()[i + size()]` aliases `data()[i]`. */
+    char* data() const { return _base; }
+
+    /** @brief Bytes in one view (page multiple; 0 if not valid). */
+    uint32_t size() const { return _size; }
+
+  private:
+
+    char*    _base;  ///< First view; the second follows at `_base + _size`.
+    uint32_t _size;  ///< Size of one view.
+};
+
+#endif // __linux__
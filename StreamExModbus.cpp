@@ -0,0 +1,286 @@
+/**
+ * @file StreamExModbus.cpp
+ * @brief Definitions for the Modbus RTU / ASCII framers.
+ */
+#include "StreamExModbus.h"
+
+#include <string.h>     // memchr
+
+// Longest ASCII frame: ':' + 2 hex chars per ADU byte (address..LRC) + CR LF.
+static const uint32_t ASCII_MAX_LINE = 1 + 2 * (STREAMEX_MODBUS_MAX_ADU - 1) + 2;
+
+#if !defined(__AVR__)
+// Byte-wise table for the reflected 0xA001 polynomial (512 bytes; AVR uses the bit loop to save RAM).
+static const uint16_t CRC16_TABLE[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+#endif
+
+// ---------------- RTU ----------------
+
+uint16_t StreamExModbusRtu::crc16(const uint8_t* data, uint32_t size, uint16_t crc)
+{
+    if (!data) return crc;
+#if defined(__AVR__)
+    while (size--)
+    {
+        crc ^= *data++;
+        for (uint8_t b = 0; b < 8; ++b) crc = (crc & 1) ? (uint16_t)((crc >> 1) ^ 0xA001) : (uint16_t)(crc >> 1);
+    }
+#else
+    while (size--) crc = (uint16_t)((crc >> 8) ^ CRC16_TABLE[(crc ^ *data++) & 0xFF]);
+#endif
+    return crc;
+}
+
+StreamExModbusRtu::StreamExModbusRtu(uint32_t baud)
+: errorCode(StreamExModbusError::None),
+_onFrame(nullptr), _context(nullptr),
+_charUs(0), _silenceUs(0), _lastUs(0),
+_pending(0), _badMask(0), _discard(false),
+_frameCount(0), _errorCount(0)
+{
+    setBaud(baud);
+}
+
+void StreamExModbusRtu::setBaud(uint32_t baud)
+{
+    if (baud == 0) baud = 19200;
+    // 11 bits per character (start + 8 data + parity/stop + stop).
+    _charUs = (11000000UL + baud - 1) / baud;
+    // The spec fixes t3.5 at 1750 µs above 19200 baud (timers can't resolve less reliably).
+    _silenceUs = (baud > 19200) ? 1750UL : (38500000UL + baud - 1) / baud;
+}
+
+bool StreamExModbusRtu::push(StreamEx& stream, const uint8_t* data, uint32_t size, uint32_t nowUs)
+{
+    if (size == 0) return true;
+    if (!data) { errorCode = StreamExModbusError::BadFrame; return false; }
+
+    const uint32_t buffered = stream.availableRx();
+    const uint32_t lastEnd  = _pending ? _ends[_pending - 1] : 0;
+
+    // Silence before this chunk's first character (the first byte ends at nowUs - (size-1)·charUs).
+    const uint32_t firstUs = nowUs - (size - 1) * _charUs;
+    const bool gap = (int32_t)(firstUs - _charUs - _lastUs) >= (int32_t)_silenceUs;
+    _lastUs = nowUs;
+
+    if (gap)
+    {
+        if (_discard) _discard = false;
+        else if (buffered > lastEnd)
+        {
+            // Queue full: the two frames merge and fail the CRC in process().
+            if (_pending < STREAMEX_MODBUS_MAX_PENDING) _ends[_pending++] = buffered;
+            else errorCode = StreamExModbusError::Overflow;
+        }
+    }
+    if (_discard) return false;
+
+    // freeRx() covers every storage mode (pool quota, bip, mirror), like send() does.
+    if (size > stream.freeRx())
+    {
+        // Never let StreamEx slide the window: it would shift the recorded offsets.
+        // Close the truncated frame as bad and ignore the rest of it.
+        if (buffered > lastEnd && _pending < STREAMEX_MODBUS_MAX_PENDING)
+        {
+            _badMask |= (1UL << _pending);
+            _ends[_pending++] = buffered;
+        }
+        _discard = true;
+        errorCode = StreamExModbusError::Overflow;
+        return false;
+    }
+    return stream.pushBackRxBuffer(reinterpret_cast<const char*>(data), size);
+}
+
+bool StreamExModbusRtu::_deliver(const uint8_t* begin, uint32_t size)
+{
+    if (size < 4 || size > STREAMEX_MODBUS_MAX_ADU) { errorCode = StreamExModbusError::BadFrame; return false; }
+    if (crc16(begin, size) != 0) { errorCode = StreamExModbusError::BadChecksum; return false; }
+
+    StreamExModbusFrame frame;
+    frame.address  = begin[0];
+    frame.function = begin[1];
+    frame.data     = begin + 2;
+    frame.size     = (uint16_t)(size - 4);
+    ++_frameCount;
+    if (_onFrame) _onFrame(frame, _context);
+    return true;
+}
+
+uint32_t StreamExModbusRtu::process(StreamEx& stream, uint32_t nowUs)
+{
+    const uint8_t* buf = reinterpret_cast<const uint8_t*>(stream.getRxBuffer());
+    const uint32_t avail = stream.availableRxContiguous();
+
+    // The trailing frame is complete once the line has been quiet for t3.5.
+    if ((int32_t)(nowUs - _lastUs) >= (int32_t)_silenceUs)
+    {
+        const uint32_t lastEnd = _pending ? _ends[_pending - 1] : 0;
+        if (_discard) _discard = false;
+        else if (avail > lastEnd && _pending < STREAMEX_MODBUS_MAX_PENDING) _ends[_pending++] = avail;
+    }
+    if (!buf || _pending == 0) return 0;
+
+    uint32_t start = 0;
+    uint32_t ok = 0;
+    for (uint8_t i = 0; i < _pending; ++i)
+    {
+        const uint32_t end = _ends[i];
+        if (end > avail) break;   // RX was modified behind our back; drop the bookkeeping
+        if (_badMask & (1UL << i)) ++_errorCount;
+        else if (_deliver(buf + start, end - start)) ++ok;
+        else ++_errorCount;
+        start = end;
+    }
+    _pending = 0;
+    _badMask = 0;
+
+    // Single compaction for all delivered frames.
+    if (start) stream.removeFrontRxBuffer(start);
+    return ok;
+}
+
+bool StreamExModbusRtu::send(StreamEx& stream, uint8_t address, uint8_t function, const uint8_t* data, uint16_t size)
+{
+    if (!data && size) { errorCode = StreamExModbusError::BadFrame; return false; }
+    if (size > STREAMEX_MODBUS_MAX_ADU - 4) { errorCode = StreamExModbusError::BadFrame; return false; }
+
+    if (stream.freeTx() < (uint32_t)size + 4) { errorCode = StreamExModbusError::TxFull; return false; }
+
+    const uint8_t head[2] = { address, function };
+    uint16_t crc = crc16(head, 2);
+    crc = crc16(data, size, crc);
+    const uint8_t tail[2] = { (uint8_t)(crc & 0xFF), (uint8_t)(crc >> 8) };
+
+    stream.pushBackTxBuffer(reinterpret_cast<const char*>(head), 2);
+    if (size) stream.pushBackTxBuffer(reinterpret_cast<const char*>(data), size);
+    stream.pushBackTxBuffer(reinterpret_cast<const char*>(tail), 2);
+    return true;
+}
+
+// ---------------- ASCII ----------------
+
+uint8_t StreamExModbusAscii::lrc(const uint8_t* data, uint32_t size, uint8_t sum)
+{
+    if (data) while (size--) sum = (uint8_t)(sum + *data++);
+    return (uint8_t)(-sum);
+}
+
+StreamExModbusAscii::StreamExModbusAscii(uint8_t* frameBuffer, uint16_t frameBufferSize)
+: errorCode(StreamExModbusError::None),
+_frame(frameBuffer), _frameSize(frameBufferSize),
+_onFrame(nullptr), _context(nullptr),
+_frameCount(0), _errorCount(0)
+{
+}
+
+bool StreamExModbusAscii::_deliver(const char* hex, uint32_t size)
+{
+    // address + function + LRC at least, whole hex pairs only.
+    if (size < 6 || (size & 1) || !_frame) { errorCode = StreamExModbusError::BadFrame; return false; }
+    if (size / 2 > _frameSize) { errorCode = StreamExModbusError::Overflow; return false; }
+
+    size_t n = 0;
+    if (!StreamEx_utility::hexDecode(_frame, _frameSize, hex, size, &n)) { errorCode = StreamExModbusError::BadFrame; return false; }
+    if (lrc(_frame, (uint32_t)n) != 0) { errorCode = StreamExModbusError::BadChecksum; return false; }
+
+    StreamExModbusFrame frame;
+    frame.address  = _frame[0];
+    frame.function = _frame[1];
+    frame.data     = _frame + 2;
+    frame.size     = (uint16_t)(n - 3);
+    ++_frameCount;
+    if (_onFrame) _onFrame(frame, _context);
+    return true;
+}
+
+uint32_t StreamExModbusAscii::process(StreamEx& stream)
+{
+    stream.available();   // sync a DMA ring first (see StreamExCommandTable::process)
+    const char* buf = stream.getRxBuffer();
+    const uint32_t avail = stream.availableRxContiguous();
+    if (!buf || avail == 0) return 0;
+
+    uint32_t consumed = 0;
+    uint32_t ok = 0;
+    for (;;)
+    {
+        // Resynchronise on ':' (noise between frames is dropped).
+        const char* start = static_cast<const char*>(memchr(buf + consumed, ':', avail - consumed));
+        if (!start) { consumed = avail; break; }
+        consumed = (uint32_t)(start - buf);
+
+        const char* nl = static_cast<const char*>(memchr(start, '\n', avail - consumed));
+        if (!nl)
+        {
+            // Incomplete: keep it unless it can no longer become a valid frame.
+            if (avail - consumed > ASCII_MAX_LINE) { ++_errorCount; errorCode = StreamExModbusError::BadFrame; consumed += 1; continue; }
+            break;
+        }
+
+        // A ':' always starts a new frame: restart at the last one before the LF.
+        for (const char* c; (c = static_cast<const char*>(memchr(start + 1, ':', (size_t)(nl - start - 1)))) != nullptr; ) start = c;
+
+        const uint32_t lineSize = (uint32_t)(nl - start);   // ':' ... CR
+        if (lineSize < 2 || nl[-1] != '\r') { ++_errorCount; errorCode = StreamExModbusError::BadFrame; }
+        else if (_deliver(start + 1, lineSize - 2)) ++ok;
+        else ++_errorCount;
+        consumed = (uint32_t)(nl - buf) + 1;
+    }
+
+    // Single compaction for all consumed frames.
+    if (consumed) stream.removeFrontRxBuffer(consumed);
+    return ok;
+}
+
+bool StreamExModbusAscii::send(StreamEx& stream, uint8_t address, uint8_t function, const uint8_t* data, uint16_t size)
+{
+    if (!data && size) { errorCode = StreamExModbusError::BadFrame; return false; }
+    if (size > STREAMEX_MODBUS_MAX_ADU - 4) { errorCode = StreamExModbusError::BadFrame; return false; }
+
+    const uint32_t need = 1 + 2 * ((uint32_t)size + 3) + 2;
+    if (stream.freeTx() < need) { errorCode = StreamExModbusError::TxFull; return false; }
+
+    const uint8_t head[2] = { address, function };
+    const uint8_t check = lrc(data, size, (uint8_t)(address + function));
+
+    stream.pushBackTxBuffer(":", 1);
+    stream.pushBackTxHex(head, 2);
+    if (size) stream.pushBackTxHex(data, size);
+    stream.pushBackTxHex(&check, 1);
+    stream.pushBackTxBuffer("\r\n", 2);
+    return true;
+}
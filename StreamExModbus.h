@@ -0,0 +1,218 @@
+#pragma once
+/**
+ * @file StreamExModbus.h
+ * @brief Modbus RTU and Modbus ASCII framing on top of ::StreamEx.
+ *
+ * @details
+ * **RTU** frames are delimited by 3.5 character times of line silence. The UART
+ * driver hands each received chunk to `StreamExModbusRtu::push()` together with a
+ * microsecond timestamp; the framer records frame boundaries from the gaps and
+ * `process()` delivers every CRC-valid frame as a view into the RX buffer:
+ *
+ * @code
+ *   void onFrame(const StreamExModbusFrame& f, void*) { handle(f.address, f.function, f.data, f.size); }
+ *
+ *   StreamExModbusRtu rtu(19200);
+ *   rtu.onFrame(onFrame);
+ *   // whenever the UART driver has bytes:
+ *   rtu.push(bus, chunk, n, micros());
+ *   // loop():
+ *   rtu.process(bus, micros());
+ * @endcode
+ *
+ * **ASCII** frames (`:` + hex + LRC + CR LF) need no timing. `StreamExModbusAscii`
+ * decodes them into a caller-provided frame buffer with the StreamEx hex kernels.
+ *
+ * Frame views are only valid inside the callback; RX is compacted once at the end
+ * of `process()`.
+ */
+
+#include "StreamEx.h"
+
+/**
+ * @def STREAMEX_MODBUS_MAX_PENDING
+ * @brief RTU frame boundaries remembered between two `process()` calls (max 32).
+ */
+#ifndef STREAMEX_MODBUS_MAX_PENDING
+  #define STREAMEX_MODBUS_MAX_PENDING 8
+#endif
+
+/**
+ * @def STREAMEX_MODBUS_MAX_ADU
+ * @brief Largest serial ADU in bytes (address + PDU + CRC).
+ */
+#define STREAMEX_MODBUS_MAX_ADU 256
+
+/**
+ * @struct StreamExModbusFrame
+ * @brief A validated frame; @p data points at the bytes after the function code.
+ */
+struct StreamExModbusFrame
+{
+    uint8_t        address;  ///< Slave address (0 = broadcast).
+    uint8_t        function; ///< Function code (bit 7 set for exception responses).
+    const uint8_t* data;     ///< PDU data (CRC/LRC excluded).
+    uint16_t       size;     ///< Number of bytes in @p data.
+};
+
+/**
+ * @enum StreamExModbusError
+ * @brief Error/status codes reported by the Modbus framers.
+ */
+enum class StreamExModbusError : int8_t
+{
+  None = 0,     ///< No error
+  BadFrame,     ///< Too short/long, missing `:`/CR LF or non-hex character
+  BadChecksum,  ///< CRC-16 (RTU) or LRC (ASCII) mismatch
+  Overflow,     ///< RX or boundary queue full; the affected frame was discarded
+  TxFull        ///< Not enough TX space for the whole frame (nothing was written)
+};
+
+/** @brief Callback for every valid frame. */
+typedef void (*StreamExModbusHandler)(const StreamExModbusFrame& frame, void* context);
+
+/**
+ * @class StreamExModbusRtu
+ * @brief Modbus RTU framer: silence detection from push timestamps plus CRC-16.
+ */
+class StreamExModbusRtu
+{
+  public:
+
+    /** @brief Last error recorded by any API call. */
+    StreamExModbusError errorCode;
+
+    /**
+     * @brief Construct a framer for @p baud (11 bits per character).
+     * @param baud Line speed; above 19200 baud the fixed 1750 µs silence of the spec is used.
+     */
+    explicit StreamExModbusRtu(uint32_t baud = 19200);
+
+    /** @brief Change the line speed (recomputes character and silence times). */
+    void setBaud(uint32_t baud);
+
+    /** @brief Inter-frame silence (t3.5) in microseconds. */
+    uint32_t silenceUs() const { return _silenceUs; }
+
+    /** @brief Register the frame callback (nullable). */
+    void onFrame(StreamExModbusHandler handler, void* context = nullptr) { _onFrame = handler; _context = context; }
+
+    /**
+     * @brief Append received bytes to @p stream's RX and track frame boundaries.
+     * @param stream Destination stream (use it for this bus only).
+     * @param data   Received bytes.
+     * @param size   Number of bytes.
+     * @param nowUs  Time the **last** byte of @p data was received (e.g. `micros()`).
+     * @retval true  Bytes buffered.
+     * @retval false RX overflow: the partial frame is discarded up to the next silence
+     *               (sets ::StreamExModbusError::Overflow).
+     *
+     * @note Chunks are assumed to arrive back to back at line speed, so the first
+     *       byte's time is derived from @p nowUs and @p size.
+     */
+    bool push(StreamEx& stream, const uint8_t* data, uint32_t size, uint32_t nowUs);
+
+    /**
+     * @brief Deliver every complete frame buffered in @p stream's RX.
+     * @param stream Stream fed by `push()`.
+     * @param nowUs  Current time; the last frame completes once t3.5 has elapsed.
+     * @return Number of valid frames dispatched.
+     */
+    uint32_t process(StreamEx& stream, uint32_t nowUs);
+
+    /**
+     * @brief Append one RTU frame (address, function, data, CRC) to TX.
+     * @return false if TX cannot hold the whole frame (sets ::StreamExModbusError::TxFull).
+     * @note The caller is responsible for the 3.5-character gap before transmitting.
+     */
+    bool send(StreamEx& stream, uint8_t address, uint8_t function, const uint8_t* data, uint16_t size);
+
+    /**
+     * @brief Modbus CRC-16 (poly 0xA001 reflected, init 0xFFFF).
+     * @param data Bytes.
+     * @param size Number of bytes.
+     * @param crc  Running value for incremental use.
+     * @return CRC; transmitted low byte first. Over a frame including its CRC the result is 0.
+     */
+    static uint16_t crc16(const uint8_t* data, uint32_t size, uint16_t crc = 0xFFFF);
+
+    /** @brief Number of valid frames seen. */
+    uint32_t frameCount() const { return _frameCount; }
+    /** @brief Number of frames rejected (length, CRC or overflow). */
+    uint32_t errorCount() const { return _errorCount; }
+
+  private:
+
+    StreamExModbusHandler _onFrame;    ///< Frame callback.
+    void*                 _context;    ///< Context for @p _onFrame.
+    uint32_t              _charUs;     ///< One character (11 bits) in microseconds.
+    uint32_t              _silenceUs;  ///< t3.5 in microseconds.
+    uint32_t              _lastUs;     ///< Receive time of the last buffered byte.
+    uint32_t              _ends[STREAMEX_MODBUS_MAX_PENDING]; ///< RX offsets where complete frames end.
+    uint8_t               _pending;    ///< Number of entries in @p _ends.
+    uint32_t              _badMask;    ///< Bit i set: frame ending at `_ends[i]` was truncated by an overflow.
+    bool                  _discard;    ///< Dropping bytes until the next silence (after overflow).
+    uint32_t              _frameCount; ///< Valid frames.
+    uint32_t              _errorCount; ///< Rejected frames.
+
+    /** @brief Validate and dispatch @p size RX bytes starting at @p begin. */
+    bool _deliver(const uint8_t* begin, uint32_t size);
+};
+
+/**
+ * @class StreamExModbusAscii
+ * @brief Modbus ASCII framer: `:` start, hex payload, LRC, CR LF end.
+ */
+class StreamExModbusAscii
+{
+  public:
+
+    /** @brief Last error recorded by any API call. */
+    StreamExModbusError errorCode;
+
+    /**
+     * @brief Construct a framer that decodes into caller-owned memory.
+     * @param frameBuffer Decoded frame storage (::STREAMEX_MODBUS_MAX_ADU bytes fits every frame).
+     * @param frameBufferSize Capacity of @p frameBuffer.
+     */
+    StreamExModbusAscii(uint8_t* frameBuffer, uint16_t frameBufferSize);
+
+    /** @brief Register the frame callback (nullable). */
+    void onFrame(StreamExModbusHandler handler, void* context = nullptr) { _onFrame = handler; _context = context; }
+
+    /**
+     * @brief Decode every complete frame buffered in @p stream's RX.
+     * @param stream Source stream; consumed bytes (and noise before `:`) are removed in one step.
+     * @return Number of valid frames dispatched.
+     */
+    uint32_t process(StreamEx& stream);
+
+    /**
+     * @brief Append one ASCII frame (`:`, hex address/function/data/LRC, CR LF) to TX.
+     * @return false if TX cannot hold the whole frame (sets ::StreamExModbusError::TxFull).
+     */
+    bool send(StreamEx& stream, uint8_t address, uint8_t function, const uint8_t* data, uint16_t size);
+
+    /**
+     * @brief Longitudinal redundancy check: two's complement of the byte sum.
+     * @return LRC; over a frame including its LRC the byte sum is 0.
+     */
+    static uint8_t lrc(const uint8_t* data, uint32_t size, uint8_t sum = 0);
+
+    /** @brief Number of valid frames seen. */
+    uint32_t frameCount() const { return _frameCount; }
+    /** @brief Number of frames rejected (framing, hex or LRC). */
+    uint32_t errorCount() const { return _errorCount; }
+
+  private:
+
+    uint8_t*              _frame;      ///< Caller-owned decode buffer.
+    uint16_t              _frameSize;  ///< Capacity of @p _frame.
+    StreamExModbusHandler _onFrame;    ///< Frame callback.
+    void*                 _context;    ///< Context for @p _onFrame.
+    uint32_t              _frameCount; ///< Valid frames.
+    uint32_t              _errorCount; ///< Rejected frames.
+
+    /** @brief Decode, validate and dispatch one `:`…CR LF line (without the `:`). */
+    bool _deliver(const char* hex, uint32_t size);
+};
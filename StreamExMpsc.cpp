@@ -0,0 +1,109 @@
+/**
+ * @file StreamExMpsc.cpp
+ * @brief Definitions for the lock-free MPSC record queue.
+ */
+#include "StreamExMpsc.h"
+
+#if !defined(__AVR__)
+
+StreamExMpscQueue::StreamExMpscQueue(void* storage, uint32_t storageSize)
+: errorCode(StreamExMpscError::None), _storage(static_cast<uint8_t*>(storage)), _mask(0), _head(0), _tail(0)
+{
+    uint32_t size = 16;
+    if (!storage || storageSize < size) { _storage = nullptr; return; }
+    while (size <= storageSize / 2) size <<= 1;
+    _mask = size - 1;
+    // Headers must read as "not committed" until a producer publishes them.
+    memset(_storage, 0, size);
+}
+
+char* StreamExMpscQueue::claim(uint32_t size)
+{
+    if (!_storage || size > maxRecord()) { errorCode.store(StreamExMpscError::TooLarge, std::memory_order_relaxed); return nullptr; }
+
+    const uint32_t span = _span(size);
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t pos, pad;
+    for (;;)
+    {
+        pos = head & _mask;
+        pad = (pos + span > _mask + 1) ? (_mask + 1 - pos) : 0;   // record must not straddle the end
+        const uint32_t tail = _tail.load(std::memory_order_acquire);
+        if (head + pad + span - tail > _mask + 1)
+        {
+            errorCode.store(StreamExMpscError::Full, std::memory_order_relaxed);
+            return nullptr;
+        }
+        // A plain fetch-add could overshoot the consumer when the queue is nearly full,
+        // so space is taken with a CAS on the same counter (still lock-free).
+        if (_head.compare_exchange_weak(head, head + pad + span, std::memory_order_relaxed, std::memory_order_relaxed)) break;
+    }
+
+    if (pad)
+    {
+        __atomic_store_n(_header(pos), COMMITTED | PADDING | pad, __ATOMIC_RELEASE);
+        pos = 0;
+    }
+    __atomic_store_n(_header(pos), size, __ATOMIC_RELAXED);   // not committed yet; commit() publishes
+    return reinterpret_cast<char*>(_storage + pos + HEADER);
+}
+
+void StreamExMpscQueue::commit(char* payload)
+{
+    if (!payload) return;
+    uint32_t* header = reinterpret_cast<uint32_t*>(payload - HEADER);
+    __atomic_store_n(header, COMMITTED | (__atomic_load_n(header, __ATOMIC_RELAXED) & LENGTH), __ATOMIC_RELEASE);
+}
+
+const char* StreamExMpscQueue::front(uint32_t* size)
+{
+    if (size) *size = 0;
+    if (!_storage) return nullptr;
+    for (;;)
+    {
+        const uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) return nullptr;
+
+        const uint32_t pos    = tail & _mask;
+        const uint32_t header = __atomic_load_n(_header(pos), __ATOMIC_ACQUIRE);
+        if (!(header & COMMITTED)) return nullptr;   // claimed, still being filled
+
+        if (header & PADDING)
+        {
+            memset(_storage + pos, 0, header & LENGTH);
+            _tail.store(tail + (header & LENGTH), std::memory_order_release);
+            continue;
+        }
+        if (size) *size = header & LENGTH;
+        return reinterpret_cast<const char*>(_storage + pos + HEADER);
+    }
+}
+
+void StreamExMpscQueue::pop()
+{
+    uint32_t size;
+    if (!front(&size)) return;   // also steps over padding
+
+    // Clear the whole span: later records may put their header anywhere in it, and a
+    // stale payload word must never look committed.
+    const uint32_t tail = _tail.load(std::memory_order_relaxed);
+    const uint32_t span = _span(size);
+    memset(_storage + (tail & _mask), 0, span);
+    _tail.store(tail + span, std::memory_order_release);
+}
+
+uint32_t StreamExMpscQueue::drainTo(StreamEx& stream)
+{
+    uint32_t moved = 0;
+    uint32_t size;
+    while (const char* record = front(&size))
+    {
+        if (size > stream.freeTx()) break;
+        stream.pushBackTxBuffer(record, size);
+        pop();
+        ++moved;
+    }
+    return moved;
+}
+
+#endif // !__AVR__
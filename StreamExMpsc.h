@@ -0,0 +1,142 @@
+#pragma once
+/**
+ * @file StreamExMpsc.h
+ * @brief Lock-free multi-producer / single-consumer record queue feeding a ::StreamEx TX path.
+ *
+ * @details
+ * Several threads append records to one ::StreamExMpscQueue without a mutex;
+ * one transmitter thread drains them in claim order:
+ *
+ * @code
+ *   alignas(4) static uint8_t storage[1 << 16];
+ *   StreamExMpscQueue queue(storage, sizeof(storage));
+ *
+ *   // any producer thread:
+ *   if (char* p = queue.claim(n)) { fill(p, n); queue.commit(p); }
+ *   // or simply: queue.push(data, n);
+ *
+ *   // the transmitter thread:
+ *   uint32_t size;
+ *   while (const char* rec = queue.front(&size)) { ::write(fd, rec, size); queue.pop(); }
+ *   // or move records into a stream's TX: queue.drainTo(link);
+ * @endcode
+ *
+ * Each record is a 4-byte header plus its payload, padded to 4 bytes, and is always
+ * contiguous (a record that would straddle the end is preceded by a padding record).
+ * Producers reserve space by advancing a shared head counter with compare-and-swap,
+ * fill their record outside any critical section, and publish it with one release
+ * store of its header. Records commit out of order but drain in claim order: the
+ * transmitter waits at the first uncommitted one.
+ *
+ * Not available on AVR (no threads, no 32-bit atomics).
+ */
+
+#include "StreamEx.h"
+
+#if !defined(__AVR__)
+
+#include <atomic>         ///< Head/tail counters
+
+/**
+ * @enum StreamExMpscError
+ * @brief Error/status codes reported by ::StreamExMpscQueue.
+ */
+enum class StreamExMpscError : int8_t
+{
+  None = 0,   ///< No error
+  Full,       ///< Not enough free space for the record (nothing was claimed)
+  TooLarge    ///< Record can never fit (larger than `maxRecord()`)
+};
+
+/**
+ * @class StreamExMpscQueue
+ * @brief Bounded byte queue of variable-size records over caller-owned memory.
+ *
+ * `claim()`, `commit()` and `push()` may be called from any number of threads at once;
+ * `front()`, `pop()` and `drainTo()` from one consumer thread only.
+ */
+class StreamExMpscQueue
+{
+  public:
+
+    /**
+     * @brief Last error seen by a producer (shared by all threads; informational only).
+     * @note Written with relaxed atomics; check the return values for per-call results.
+     */
+    std::atomic<StreamExMpscError> errorCode;
+
+    /**
+     * @brief Construct over caller-owned memory.
+     * @param storage     4-byte aligned memory (cleared here; must outlive the queue).
+     * @param storageSize Size in bytes; rounded down to a power of two (at least 16).
+     */
+    StreamExMpscQueue(void* storage, uint32_t storageSize);
+
+    /**
+     * @brief Reserve a record of @p size payload bytes (thread-safe, lock-free).
+     * @return Payload pointer to fill, then pass to `commit()`; nullptr if the queue is full
+     *         (::StreamExMpscError::Full) or @p size exceeds `maxRecord()`.
+     * @note Every successful claim must be committed, or the consumer stalls at it.
+     */
+    char* claim(uint32_t size);
+
+    /** @brief Publish a record obtained from `claim()` (thread-safe, one release store). */
+    void commit(char* payload);
+
+    /** @brief Claim, copy and commit in one call (thread-safe). */
+    bool push(const char* data, uint32_t size)
+    {
+        char* p = claim(size);
+        if (!p) return false;
+        memcpy(p, data, size);
+        commit(p);
+        return true;
+    }
+
+    /**
+     * @brief Oldest committed record (consumer only).
+     * @param size Receives the payload size.
+     * @return Payload, valid until `pop()`; nullptr if the queue is empty or the oldest
+     *         claimed record is not committed yet.
+     */
+    const char* front(uint32_t* size);
+
+    /** @brief Release the record returned by `front()` (consumer only). */
+    void pop();
+
+    /**
+     * @brief Move committed records into @p stream's TX while they fit (consumer only).
+     * @return Number of records moved; a record is never split.
+     */
+    uint32_t drainTo(StreamEx& stream);
+
+    /**
+     * @brief Largest payload a single record can carry.
+     * @note Half the storage, so a record fits either before the end or after a wrap
+     *       once the queue drains, wherever the head is.
+     */
+    uint32_t maxRecord() const { return (_mask + 1) / 2 - HEADER; }
+
+    /** @brief Bytes claimed and not yet popped, headers and padding included (snapshot). */
+    uint32_t used() const { return _head.load(std::memory_order_relaxed) - _tail.load(std::memory_order_relaxed); }
+
+  private:
+
+    static constexpr uint32_t HEADER    = 4;            ///< Header bytes per record.
+    static constexpr uint32_t COMMITTED = 0x80000000u;  ///< Header flag: record is published.
+    static constexpr uint32_t PADDING   = 0x40000000u;  ///< Header flag: skip to the end of the storage.
+    static constexpr uint32_t LENGTH    = 0x3FFFFFFFu;  ///< Header bits holding the payload size.
+
+    uint8_t*              _storage;  ///< Caller-owned record storage.
+    uint32_t              _mask;     ///< Storage size - 1 (power of two).
+    std::atomic<uint32_t> _head;     ///< Bytes claimed so far (producers, wraps).
+    std::atomic<uint32_t> _tail;     ///< Bytes released so far (consumer, wraps).
+
+    /** @brief Header word at storage offset @p offset. */
+    uint32_t* _header(uint32_t offset) const { return reinterpret_cast<uint32_t*>(_storage + offset); }
+
+    /** @brief Bytes a record of @p size payload bytes occupies. */
+    static uint32_t _span(uint32_t size) { return HEADER + ((size + 3u) & ~3u); }
+};
+
+#endif // !__AVR__
@@ -0,0 +1,251 @@
+/**
+ * @file StreamExNmea.cpp
+ * @brief Definitions for the streaming NMEA 0183 parser.
+ */
+#include "StreamExNmea.h"
+
+#include <algorithm>    // std::min
+#include <string.h>     // memchr, memcmp, memset
+
+// Parse a decimal field "ddd[.fff]" into value × 10^decimals (extra decimals truncated).
+static bool parseScaled(const StreamExNmeaField& f, uint8_t decimals, bool allowSign, int32_t* out)
+{
+    uint8_t i = 0;
+    bool neg = false;
+    if (allowSign && i < f.size && (f.data[i] == '-' || f.data[i] == '+')) { neg = (f.data[i] == '-'); ++i; }
+
+    // Fields are short (≤ 255 chars) but may be hostile: stop as soon as v leaves int32 range.
+    uint64_t v = 0;
+    uint8_t digits = 0;
+    for (; i < f.size && StreamEx_utility::isDigit(f.data[i]); ++i, ++digits)
+    {
+        v = v * 10 + (uint32_t)(f.data[i] - '0');
+        if (v > (uint64_t)INT32_MAX) return false;
+    }
+    uint8_t kept = 0;
+    if (i < f.size && f.data[i] == '.')
+    {
+        for (++i; i < f.size && StreamEx_utility::isDigit(f.data[i]); ++i, ++digits)
+            if (kept < decimals) { v = v * 10 + (uint32_t)(f.data[i] - '0'); ++kept; }
+    }
+    if (i != f.size || digits == 0) return false;
+    for (; kept < decimals; ++kept) v *= 10;
+    if (v > (uint64_t)INT32_MAX) return false;
+    *out = neg ? -(int32_t)v : (int32_t)v;
+    return true;
+}
+
+// Empty fields (no fix yet) decode as zero.
+static bool parseScaledOrZero(const StreamExNmeaField& f, uint8_t decimals, bool allowSign, int32_t* out)
+{
+    if (f.size == 0) { *out = 0; return true; }
+    return parseScaled(f, decimals, allowSign, out);
+}
+
+static bool twoDigits(const char* p, uint8_t* out)
+{
+    if (!StreamEx_utility::isDigit(p[0]) || !StreamEx_utility::isDigit(p[1])) return false;
+    *out = (uint8_t)((p[0] - '0') * 10 + (p[1] - '0'));
+    return true;
+}
+
+StreamExNmea::StreamExNmea()
+: errorCode(StreamExNmeaError::None),
+_onSentence(nullptr), _onGga(nullptr), _onRmc(nullptr),
+_sentenceContext(nullptr), _ggaContext(nullptr), _rmcContext(nullptr),
+_sentenceCount(0), _errorCount(0)
+{
+}
+
+bool StreamExNmea::parseSentence(const char* line, uint32_t size, StreamExNmeaSentence* out)
+{
+    if (!line || !out || size < 7 || line[0] != '$' || size > STREAMEX_NMEA_MAX_LENGTH) {
+        errorCode = StreamExNmeaError::BadFrame; return false;
+    }
+
+    // "...*hh" — checksum is the XOR of everything between '$' and '*'.
+    if (line[size - 3] != '*') { errorCode = StreamExNmeaError::BadFrame; return false; }
+    const uint8_t hi = StreamEx_utility::hexValue(line[size - 2]);
+    const uint8_t lo = StreamEx_utility::hexValue(line[size - 1]);
+    if ((hi | lo) & 0xF0) { errorCode = StreamExNmeaError::BadFrame; return false; }
+
+    const char* body = line + 1;
+    const char* end  = line + size - 3;
+    uint8_t sum = 0;
+    for (const char* p = body; p < end; ++p) sum ^= (uint8_t)*p;
+    if (sum != (uint8_t)((hi << 4) | lo)) { errorCode = StreamExNmeaError::BadChecksum; return false; }
+
+    // Address field: talker (2 chars, or 'P' for proprietary) + formatter.
+    const char* comma = static_cast<const char*>(memchr(body, ',', (size_t)(end - body)));
+    const char* addrEnd = comma ? comma : end;
+    const uint8_t addrLen = (uint8_t)(addrEnd - body);
+    const uint8_t talkerLen = (body[0] == 'P') ? 1 : 2;
+    if (addrLen <= talkerLen) { errorCode = StreamExNmeaError::BadFrame; return false; }
+
+    memset(out->talker, 0, sizeof(out->talker));
+    memset(out->type, 0, sizeof(out->type));
+    memcpy(out->talker, body, talkerLen);
+    memcpy(out->type, body + talkerLen, std::min<uint8_t>((uint8_t)(addrLen - talkerLen), (uint8_t)(sizeof(out->type) - 1)));
+
+    out->fieldCount = 0;
+    const char* p = comma;
+    while (p && p < end)
+    {
+        if (out->fieldCount == STREAMEX_NMEA_MAX_FIELDS) { errorCode = StreamExNmeaError::TooManyFields; return false; }
+        const char* f = p + 1;
+        const char* next = static_cast<const char*>(memchr(f, ',', (size_t)(end - f)));
+        const char* fEnd = next ? next : end;
+        out->fields[out->fieldCount].data = f;
+        out->fields[out->fieldCount].size = (uint8_t)(fEnd - f);
+        ++out->fieldCount;
+        p = next;
+    }
+    return true;
+}
+
+bool StreamExNmea::decodeTime(const StreamExNmeaField& value, uint32_t* out)
+{
+    if (!out) return false;
+    if (value.size == 0) { *out = 0; return true; }
+    uint8_t h, m, s;
+    if (value.size < 6 || !twoDigits(value.data, &h) || !twoDigits(value.data + 2, &m) || !twoDigits(value.data + 4, &s))
+        return false;
+
+    // Fractional seconds → milliseconds.
+    int32_t ms = 0;
+    if (value.size > 6)
+    {
+        const StreamExNmeaField frac = { value.data + 6, (uint8_t)(value.size - 6) };
+        if (frac.data[0] != '.' || !parseScaled(frac, 3, false, &ms)) return false;
+    }
+    *out = ((uint32_t)h * 3600UL + (uint32_t)m * 60UL + s) * 1000UL + (uint32_t)ms;
+    return true;
+}
+
+bool StreamExNmea::decodeCoordinate(const StreamExNmeaField& value, const StreamExNmeaField& hemisphere, int32_t* out)
+{
+    if (!out) return false;
+    if (value.size == 0) { *out = 0; return true; }
+
+    const char* dot = static_cast<const char*>(memchr(value.data, '.', value.size));
+    const uint8_t intLen = dot ? (uint8_t)(dot - value.data) : value.size;
+    if (intLen < 3 || intLen > 5) return false;   // ddmm or dddmm
+
+    // Degrees are everything before the two minute digits.
+    uint32_t deg = 0;
+    for (uint8_t i = 0; i < intLen - 2; ++i)
+    {
+        if (!StreamEx_utility::isDigit(value.data[i])) return false;
+        deg = deg * 10 + (uint32_t)(value.data[i] - '0');
+    }
+    // Minutes with 6 decimals: mm.mmmmmm × 1e6 (< 6e7).
+    int32_t minE6 = 0;
+    StreamExNmeaField minutes = { value.data + intLen - 2, (uint8_t)(value.size - intLen + 2) };
+    if (!parseScaled(minutes, 6, false, &minE6) || minE6 >= 60000000L || deg > 180) return false;
+
+    // deg × 1e7 + minutes / 60 × 1e7  ==  deg × 1e7 + minE6 / 6 (rounded).
+    int32_t v = (int32_t)(deg * 10000000UL + ((uint32_t)minE6 + 3) / 6);
+
+    if (hemisphere.size != 1) return false;
+    const char h = hemisphere.data[0];
+    if (h == 'S' || h == 'W') v = -v;
+    else if (h != 'N' && h != 'E') return false;
+    *out = v;
+    return true;
+}
+
+bool StreamExNmea::decodeGga(const StreamExNmeaSentence& s, StreamExNmeaGga* out)
+{
+    if (!out || s.fieldCount < 9 || memcmp(s.type, "GGA", 4) != 0) return false;
+    int32_t quality = 0, sats = 0, hdop = 0;
+    if (!decodeTime(s.fields[0], &out->timeMs) ||
+        !decodeCoordinate(s.fields[1], s.fields[2], &out->latitude) ||
+        !decodeCoordinate(s.fields[3], s.fields[4], &out->longitude) ||
+        !parseScaledOrZero(s.fields[5], 0, false, &quality) ||
+        !parseScaledOrZero(s.fields[6], 0, false, &sats) ||
+        !parseScaledOrZero(s.fields[7], 2, false, &hdop) ||
+        !parseScaledOrZero(s.fields[8], 2, true,  &out->altitudeCm) ||
+        quality > 255 || sats > 255 || hdop > 0xFFFF)
+        return false;
+    out->fixQuality = (uint8_t)quality;
+    out->satellites = (uint8_t)sats;
+    out->hdop = (uint16_t)hdop;
+    return true;
+}
+
+bool StreamExNmea::decodeRmc(const StreamExNmeaSentence& s, StreamExNmeaRmc* out)
+{
+    if (!out || s.fieldCount < 9 || memcmp(s.type, "RMC", 4) != 0) return false;
+    int32_t speed = 0, course = 0;
+    if (!decodeTime(s.fields[0], &out->timeMs) ||
+        s.fields[1].size != 1 ||
+        !decodeCoordinate(s.fields[2], s.fields[3], &out->latitude) ||
+        !decodeCoordinate(s.fields[4], s.fields[5], &out->longitude) ||
+        !parseScaledOrZero(s.fields[6], 3, false, &speed) ||
+        !parseScaledOrZero(s.fields[7], 2, false, &course))
+        return false;
+    out->active = (s.fields[1].data[0] == 'A');
+    out->speedMilliKnots = (uint32_t)speed;
+    out->courseCentiDeg = (uint32_t)course;
+
+    const StreamExNmeaField& d = s.fields[8];
+    out->day = out->month = out->year = 0;
+    if (d.size != 0 &&
+        (d.size != 6 || !twoDigits(d.data, &out->day) || !twoDigits(d.data + 2, &out->month) || !twoDigits(d.data + 4, &out->year)))
+        return false;
+    return true;
+}
+
+void StreamExNmea::_dispatch(const StreamExNmeaSentence& sentence)
+{
+    if (_onSentence) _onSentence(sentence, _sentenceContext);
+
+    if (_onGga && memcmp(sentence.type, "GGA", 4) == 0)
+    {
+        StreamExNmeaGga gga;
+        if (decodeGga(sentence, &gga)) _onGga(gga, _ggaContext);
+        else errorCode = StreamExNmeaError::BadField;
+    }
+    else if (_onRmc && memcmp(sentence.type, "RMC", 4) == 0)
+    {
+        StreamExNmeaRmc rmc;
+        if (decodeRmc(sentence, &rmc)) _onRmc(rmc, _rmcContext);
+        else errorCode = StreamExNmeaError::BadField;
+    }
+}
+
+uint32_t StreamExNmea::process(StreamEx& stream)
+{
+    stream.available();   // sync a DMA ring first (see StreamExCommandTable::process)
+    const char* buf = stream.getRxBuffer();
+    const uint32_t avail = stream.availableRxContiguous();
+    if (!buf || avail == 0) return 0;
+
+    StreamExNmeaSentence sentence;
+    uint32_t consumed = 0;
+    uint32_t ok = 0;
+    for (;;)
+    {
+        // Resynchronise on '$' (drops noise and partial sentences from before a reset).
+        const char* start = static_cast<const char*>(memchr(buf + consumed, '$', avail - consumed));
+        if (!start) { consumed = avail; break; }
+        consumed = (uint32_t)(start - buf);
+
+        const char* nl = static_cast<const char*>(memchr(start, '\n', avail - consumed));
+        if (!nl)
+        {
+            // Incomplete: keep it unless it can no longer become a valid sentence.
+            if (avail - consumed > STREAMEX_NMEA_MAX_LENGTH + 2) { ++_errorCount; errorCode = StreamExNmeaError::BadFrame; consumed += 1; continue; }
+            break;
+        }
+
+        uint32_t size = (uint32_t)(nl - start);
+        if (size && start[size - 1] == '\r') --size;
+        if (parseSentence(start, size, &sentence)) { ++_sentenceCount; ++ok; _dispatch(sentence); }
+        else ++_errorCount;
+        consumed = (uint32_t)(nl - buf) + 1;
+    }
+
+    if (consumed) stream.removeFrontRxBuffer(consumed);
+    return ok;
+}
@@ -0,0 +1,195 @@
+#pragma once
+/**
+ * @file StreamExNmea.h
+ * @brief Streaming NMEA 0183 sentence parser on top of ::StreamEx.
+ *
+ * @details
+ * Feed receiver bytes with `StreamEx::pushBackRxBuffer()` and call
+ * `StreamExNmea::process()` from `loop()`. Every complete sentence in RX is
+ * checksum-verified and tokenized into field views that point straight into the
+ * RX buffer (no copies). `GGA` and `RMC` are converted to typed structs using
+ * integer/fixed-point arithmetic only; any talker (`GP`, `GN`, `GL`, `GA`, `GB`,
+ * `BD`, ...) is accepted, so multi-constellation receivers work unchanged.
+ *
+ * @code
+ *   void onFix(const StreamExNmeaGga& gga, void*) { lat = gga.latitude; }
+ *
+ *   StreamExNmea nmea;
+ *   nmea.onGga(onFix);
+ *   // loop():
+ *   gps.pushBackRxBuffer(chunk, n);
+ *   nmea.process(gps);
+ * @endcode
+ *
+ * Field views and sentence structs are only valid inside the callbacks; RX is
+ * compacted once at the end of `process()`.
+ */
+
+#include "StreamEx.h"
+
+/**
+ * @def STREAMEX_NMEA_MAX_FIELDS
+ * @brief Maximum number of comma-separated fields kept per sentence (GSV needs 20).
+ */
+#ifndef STREAMEX_NMEA_MAX_FIELDS
+  #define STREAMEX_NMEA_MAX_FIELDS 24
+#endif
+
+/**
+ * @def STREAMEX_NMEA_MAX_LENGTH
+ * @brief Longest accepted sentence in bytes from `$` to the checksum (NMEA allows 82 incl. CRLF).
+ */
+#ifndef STREAMEX_NMEA_MAX_LENGTH
+  #define STREAMEX_NMEA_MAX_LENGTH 96
+#endif
+
+/**
+ * @struct StreamExNmeaField
+ * @brief View of one field inside the RX buffer (not NUL-terminated).
+ */
+struct StreamExNmeaField
+{
+    const char* data;  ///< First character of the field.
+    uint8_t     size;  ///< Number of characters (0 for an empty field).
+};
+
+/**
+ * @struct StreamExNmeaSentence
+ * @brief A checksum-verified, tokenized sentence.
+ *
+ * For `$GNGGA,...` `talker` is "GN", `type` is "GGA" and `fields[0]` is the
+ * first field after the address.
+ */
+struct StreamExNmeaSentence
+{
+    char              talker[3];                          ///< Talker ID ("GP", "GN", ...; "P" + maker for proprietary).
+    char              type[4];                            ///< Sentence formatter ("GGA", "RMC", ...).
+    uint8_t           fieldCount;                         ///< Number of entries used in @p fields.
+    StreamExNmeaField fields[STREAMEX_NMEA_MAX_FIELDS];   ///< Field views.
+};
+
+/**
+ * @struct StreamExNmeaGga
+ * @brief GGA — fix data.
+ */
+struct StreamExNmeaGga
+{
+    uint32_t timeMs;       ///< UTC time of day in milliseconds.
+    int32_t  latitude;     ///< Degrees × 1e7 (north positive).
+    int32_t  longitude;    ///< Degrees × 1e7 (east positive).
+    uint8_t  fixQuality;   ///< 0 = invalid, 1 = GPS, 2 = DGPS, 4 = RTK fixed, 5 = RTK float, ...
+    uint8_t  satellites;   ///< Satellites in use.
+    uint16_t hdop;         ///< Horizontal dilution × 100.
+    int32_t  altitudeCm;   ///< Altitude above mean sea level in centimetres.
+};
+
+/**
+ * @struct StreamExNmeaRmc
+ * @brief RMC — recommended minimum data.
+ */
+struct StreamExNmeaRmc
+{
+    uint32_t timeMs;       ///< UTC time of day in milliseconds.
+    bool     active;       ///< Status 'A' (valid) vs 'V' (void).
+    int32_t  latitude;     ///< Degrees × 1e7 (north positive).
+    int32_t  longitude;    ///< Degrees × 1e7 (east positive).
+    uint32_t speedMilliKnots; ///< Speed over ground in knots × 1000.
+    uint32_t courseCentiDeg;  ///< Course over ground in degrees × 100.
+    uint8_t  day;          ///< UTC day (1..31).
+    uint8_t  month;        ///< UTC month (1..12).
+    uint8_t  year;         ///< UTC year modulo 100.
+};
+
+/**
+ * @enum StreamExNmeaError
+ * @brief Error/status codes reported by ::StreamExNmea.
+ */
+enum class StreamExNmeaError : int8_t
+{
+  None = 0,       ///< No error
+  BadFrame,       ///< Missing `$`, missing `*hh` or sentence too long
+  BadChecksum,    ///< Checksum mismatch
+  TooManyFields,  ///< More than ::STREAMEX_NMEA_MAX_FIELDS fields
+  BadField        ///< A field of a typed sentence could not be converted
+};
+
+/**
+ * @class StreamExNmea
+ * @brief NMEA 0183 framer, checksum verifier and typed decoder.
+ */
+class StreamExNmea
+{
+  public:
+
+    /** @brief Callback for every valid sentence. */
+    typedef void (*SentenceHandler)(const StreamExNmeaSentence& sentence, void* context);
+    /** @brief Callback for decoded GGA sentences. */
+    typedef void (*GgaHandler)(const StreamExNmeaGga& gga, void* context);
+    /** @brief Callback for decoded RMC sentences. */
+    typedef void (*RmcHandler)(const StreamExNmeaRmc& rmc, void* context);
+
+    /** @brief Last error recorded by any API call. */
+    StreamExNmeaError errorCode;
+
+    StreamExNmea();
+
+    /** @brief Register a callback for every valid sentence (nullable). */
+    void onSentence(SentenceHandler handler, void* context = nullptr) { _onSentence = handler; _sentenceContext = context; }
+    /** @brief Register a callback for GGA sentences (nullable). */
+    void onGga(GgaHandler handler, void* context = nullptr) { _onGga = handler; _ggaContext = context; }
+    /** @brief Register a callback for RMC sentences (nullable). */
+    void onRmc(RmcHandler handler, void* context = nullptr) { _onRmc = handler; _rmcContext = context; }
+
+    /**
+     * @brief Parse every complete sentence buffered in @p stream's RX.
+     * @param stream Source stream; consumed bytes (and garbage before `$`) are removed in one step.
+     * @return Number of valid sentences dispatched.
+     */
+    uint32_t process(StreamEx& stream);
+
+    /**
+     * @brief Verify and tokenize one sentence.
+     * @param line Characters from `$` up to (not including) CR/LF.
+     * @param size Number of characters.
+     * @param out  Destination; field views point into @p line.
+     * @return true if framing and checksum are valid.
+     */
+    bool parseSentence(const char* line, uint32_t size, StreamExNmeaSentence* out);
+
+    /** @brief Decode a GGA sentence (fields may be empty before a fix; those read as 0). */
+    static bool decodeGga(const StreamExNmeaSentence& sentence, StreamExNmeaGga* out);
+
+    /** @brief Decode an RMC sentence. */
+    static bool decodeRmc(const StreamExNmeaSentence& sentence, StreamExNmeaRmc* out);
+
+    /**
+     * @brief Convert `ddmm.mmmm` / `dddmm.mmmm` plus hemisphere to degrees × 1e7.
+     * @param value      Coordinate field.
+     * @param hemisphere 'N'/'S'/'E'/'W' field.
+     * @param out        Destination (0 for empty fields).
+     * @return false on malformed input.
+     */
+    static bool decodeCoordinate(const StreamExNmeaField& value, const StreamExNmeaField& hemisphere, int32_t* out);
+
+    /** @brief Convert `hhmmss[.sss]` to milliseconds since midnight. */
+    static bool decodeTime(const StreamExNmeaField& value, uint32_t* out);
+
+    /** @brief Number of valid sentences seen. */
+    uint32_t sentenceCount() const { return _sentenceCount; }
+    /** @brief Number of sentences rejected for framing/checksum errors. */
+    uint32_t errorCount() const { return _errorCount; }
+
+  private:
+
+    SentenceHandler _onSentence;       ///< Generic sentence callback.
+    GgaHandler      _onGga;            ///< GGA callback.
+    RmcHandler      _onRmc;            ///< RMC callback.
+    void*           _sentenceContext;  ///< Context for @p _onSentence.
+    void*           _ggaContext;       ///< Context for @p _onGga.
+    void*           _rmcContext;       ///< Context for @p _onRmc.
+    uint32_t        _sentenceCount;    ///< Valid sentences.
+    uint32_t        _errorCount;       ///< Rejected sentences.
+
+    /** @brief Dispatch a verified sentence to the callbacks. */
+    void _dispatch(const StreamExNmeaSentence& sentence);
+};
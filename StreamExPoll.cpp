@@ -0,0 +1,77 @@
+/**
+ * @file StreamExPoll.cpp
+ * @brief Definitions for the cooperative poll-step scheduler.
+ */
+#include "StreamExPoll.h"
+
+StreamExPoller::StreamExPoller(StreamExPollHandler* handlers, uint8_t count)
+: _handlers(handlers), _count(handlers ? count : 0), _next(0), _lastPollUs(0), _maxPollUs(0)
+{}
+
+uint32_t StreamExPoller::_step(StreamExPollHandler& h, uint32_t limit)
+{
+    // available() also syncs a DMA ring, so the step sees wrapped bytes in one run.
+    if (h.stalled || !h.stream || !h.step || h.stream->available() == 0) return 0;
+
+    uint32_t size = h.stream->availableRxContiguous();
+    if (size > h.quantum) size = h.quantum;
+    if (size > limit)     size = limit;
+    if (size == 0) return 0;
+
+    const uint32_t t0 = micros();
+    uint32_t used = h.step(*h.stream, h.stream->getRxBuffer(), size, h.context);
+    const uint32_t us = micros() - t0;
+
+    if (used > size) used = size;
+    // One compaction per step instead of one per byte read.
+    if (used) h.stream->removeFrontRxBuffer(used);
+    h.stalled = (used == 0);
+
+    ++h.steps;
+    h.bytes += used;
+    if (us > h.maxStepUs) h.maxStepUs = us;
+    return used;
+}
+
+uint32_t StreamExPoller::poll(uint32_t budget)
+{
+    const uint32_t t0 = micros();
+    uint32_t done = 0;
+    bool progress = true;
+    const uint8_t first = _next;
+    for (uint8_t i = 0; i < _count; ++i) _handlers[i].stalled = false;
+
+    while (progress && done < budget && _count)
+    {
+        progress = false;
+        for (uint8_t n = 0; n < _count && done < budget; ++n)
+        {
+            const uint32_t used = _step(_handlers[(first + n) % _count], budget - done);
+            if (used) { done += used; progress = true; }
+        }
+    }
+    if (_count) _next = (uint8_t)((first + 1) % _count);
+
+    _lastPollUs = micros() - t0;
+    if (_lastPollUs > _maxPollUs) _maxPollUs = _lastPollUs;
+    return done;
+}
+
+uint32_t StreamExPoller::backlog() const
+{
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < _count; ++i)
+        if (_handlers[i].stream) total += _handlers[i].stream->availableRx();
+    return total;
+}
+
+void StreamExPoller::resetStats()
+{
+    _lastPollUs = _maxPollUs = 0;
+    for (uint8_t i = 0; i < _count; ++i)
+    {
+        _handlers[i].steps = 0;
+        _handlers[i].bytes = 0;
+        _handlers[i].maxStepUs = 0;
+    }
+}
@@ -0,0 +1,124 @@
+#pragma once
+/**
+ * @file StreamExPoll.h
+ * @brief Cooperative poll-step scheduler: many protocol handlers, bounded work per `loop()`.
+ *
+ * @details
+ * Each ::StreamExPollHandler is a small state machine bound to one stream. Instead of
+ * looping over `available()` / `read()` itself, it is offered a contiguous view of its
+ * RX data (at most `quantum` bytes) and returns how many bytes it consumed; the poller
+ * then removes them from RX in one step:
+ *
+ * @code
+ *   uint32_t gpsStep(StreamEx& s, const char* data, uint32_t size, void* ctx) {
+ *     // advance the parser over data[0..size), return bytes used (0 = wait for more)
+ *   }
+ *
+ *   static StreamExPollHandler handlers[] = {
+ *       StreamExPollHandler(&gpsLink,   gpsStep,   &gps,   32),
+ *       StreamExPollHandler(&radioLink, radioStep, &radio, 64),
+ *   };
+ *   StreamExPoller poller(handlers, 2);
+ *
+ *   void loop() {
+ *     poller.poll(128);           // at most 128 bytes of protocol work per pass
+ *     // ... other work with a predictable time slice
+ *   }
+ * @endcode
+ *
+ * Handlers run round-robin and the round starts one handler further on every call, so
+ * a busy or slow handler cannot starve the others. `poll()` records how long each call
+ * and each step took (`micros()`), which makes the loop jitter directly measurable.
+ */
+
+#include "StreamEx.h"
+
+/**
+ * @brief One cooperative step of a protocol handler.
+ * @param stream  Stream the handler is bound to (may also be used to queue TX replies).
+ * @param data    Oldest unread RX bytes (contiguous, valid during the call).
+ * @param size    Bytes in @p data (1 .. handler quantum).
+ * @param context User pointer registered with the handler.
+ * @return Bytes consumed from the front of @p data (0 = incomplete, wait for more).
+ */
+typedef uint32_t (*StreamExPollStep)(StreamEx& stream, const char* data, uint32_t size, void* context);
+
+/**
+ * @struct StreamExPollHandler
+ * @brief Registration and statistics of one handler (caller-owned, in an array).
+ */
+struct StreamExPollHandler
+{
+    StreamEx*        stream;     ///< Bound stream (nullptr = disabled).
+    StreamExPollStep step;       ///< Step function.
+    void*            context;    ///< User pointer passed to @p step.
+    uint32_t         quantum;    ///< Most bytes offered per step.
+
+    uint32_t         steps;      ///< Steps run since the last `resetStats()`.
+    uint32_t         bytes;      ///< Bytes consumed since the last `resetStats()`.
+    uint32_t         maxStepUs;  ///< Slowest step since the last `resetStats()`, in µs.
+    bool             stalled;    ///< Last step consumed nothing (skipped until the next `poll()`).
+
+    /**
+     * @brief Register a handler.
+     * @param s   Stream to serve.
+     * @param fn  Step function.
+     * @param ctx User pointer for @p fn.
+     * @param q   Quantum: most bytes per step. A handler that needs a whole frame before it
+     *            can consume anything must get a quantum of at least one frame.
+     */
+    StreamExPollHandler(StreamEx* s, StreamExPollStep fn, void* ctx = nullptr, uint32_t q = 64)
+    : stream(s), step(fn), context(ctx), quantum(q ? q : 1), steps(0), bytes(0), maxStepUs(0), stalled(false) {}
+};
+
+/**
+ * @class StreamExPoller
+ * @brief Round-robin driver for an array of ::StreamExPollHandler with a per-call budget.
+ *
+ * The poller does not own the handler array; it must outlive the poller.
+ */
+class StreamExPoller
+{
+  public:
+
+    /**
+     * @brief Construct over caller-owned handlers.
+     * @param handlers Handler array (must outlive the poller).
+     * @param count    Number of handlers.
+     */
+    StreamExPoller(StreamExPollHandler* handlers, uint8_t count);
+
+    /**
+     * @brief Run handler steps until @p budget bytes were consumed or nobody can progress.
+     * @param budget Most bytes consumed in this call, across all handlers.
+     * @return Bytes consumed.
+     *
+     * Each round offers every handler one step of at most its quantum (clipped to what is
+     * left of the budget); rounds repeat while some handler made progress. A step that
+     * consumes nothing is not retried within the same call.
+     */
+    uint32_t poll(uint32_t budget);
+
+    /** @brief Unread RX bytes across all handler streams (work still queued). */
+    uint32_t backlog() const;
+
+    /** @brief Duration of the last `poll()` in µs. */
+    uint32_t lastPollUs() const { return _lastPollUs; }
+
+    /** @brief Longest `poll()` since the last `resetStats()`, in µs (the loop jitter bound). */
+    uint32_t maxPollUs() const { return _maxPollUs; }
+
+    /** @brief Clear poller and handler statistics. */
+    void resetStats();
+
+  private:
+
+    StreamExPollHandler* _handlers;   ///< Caller-owned handler array.
+    uint8_t              _count;      ///< Number of handlers.
+    uint8_t              _next;       ///< Handler that starts the next round (fairness).
+    uint32_t             _lastPollUs; ///< Duration of the last `poll()`.
+    uint32_t             _maxPollUs;  ///< Longest `poll()` since `resetStats()`.
+
+    /** @brief Run one step of @p h with at most @p limit bytes; returns bytes consumed. */
+    static uint32_t _step(StreamExPollHandler& h, uint32_t limit);
+};
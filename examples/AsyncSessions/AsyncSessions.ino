@@ -0,0 +1,103 @@
+/**
+ * @file AsyncSessions.ino
+ * @brief Many line-echo sessions as C++20 coroutines on one thread, using ::StreamExAsync.
+ *
+ * Each session is a coroutine that awaits a line, echoes it and awaits the flush.
+ * A simulated transport pushes one line into every session per round and drains the
+ * echoes; parked sessions cost their frame and nothing else (no thread, no allocation
+ * per wait).
+ *
+ * Needs a compiler with C++20 coroutines (e.g. a host build with `-std=c++20`).
+ */
+
+#include "StreamExAsync.h"
+
+#if defined(STREAMEX_HAS_COROUTINES)
+
+#include <exception>
+
+constexpr uint32_t SESSIONS = 1000;
+constexpr uint32_t ROUNDS   = 100;
+constexpr uint32_t BUF_SIZE = 64;
+
+// Minimal eager, fire-and-forget coroutine type; the frame frees itself at the end.
+struct Session
+{
+  struct promise_type
+  {
+    Session get_return_object() { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+struct Link
+{
+  char tx[BUF_SIZE];
+  char rx[BUF_SIZE];
+  StreamEx stream{tx, sizeof(tx), rx, sizeof(rx)};
+  StreamExAsync io{stream};
+};
+
+Link links[SESSIONS];
+uint32_t echoed = 0;
+
+Session echoSession(StreamExAsync& io)
+{
+  char line[32];
+  for (;;)
+  {
+    const int32_t n = co_await io.readLine(line, sizeof(line));
+    if (n < 0) co_return;
+    io.stream().pushBackTxBuffer(line, (uint32_t)n);
+    io.stream().pushBackTxBuffer("\n", 1);
+    if (!co_await io.flushTx()) co_return;
+    ++echoed;
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  for (Link& link : links) echoSession(link.io);
+
+  char out[BUF_SIZE];
+  uint32_t sent = 0;
+  const unsigned long t0 = micros();
+  for (uint32_t round = 0; round < ROUNDS; ++round)
+  {
+    for (Link& link : links)
+    {
+      link.io.pushRx("ping\n", 5);                   // resumes the session: it echoes and parks on flushTx()
+      sent += link.io.popTx(out, sizeof(out));       // transport drains TX: resumes it, it parks on readLine()
+    }
+  }
+  const unsigned long us = micros() - t0;
+
+  for (Link& link : links) link.io.close();          // every session leaves its loop and frees its frame
+
+  Serial.print(SESSIONS);
+  Serial.print(F(" sessions, "));
+  Serial.print(echoed);
+  Serial.print(F(" echoes ("));
+  Serial.print(sent);
+  Serial.print(F(" bytes) in "));
+  Serial.print(us);
+  Serial.print(F(" us, "));
+  Serial.print(us ? (unsigned long)((uint64_t)echoed * 1000000ULL / us) : 0UL);
+  Serial.println(F(" echoes/s"));
+}
+
+#else
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println(F("AsyncSessions needs C++20 coroutines."));
+}
+
+#endif
+
+void loop() {}
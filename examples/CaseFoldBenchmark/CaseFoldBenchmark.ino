@@ -0,0 +1,88 @@
+/**
+ * @file CaseFoldBenchmark.ino
+ * @brief Compare byte-wise `tolower()` comparison against the word-at-a-time StreamEx helpers.
+ *
+ * This sketch times:
+ *  - The previous `iequal()` implementation (per-byte `tolower()` on both strings).
+ *  - `StreamEx_utility::iequal()` / `iequalN()` (SWAR / SSE2 folding).
+ *  - `StreamEx_utility::ihashN()` against a per-byte `tolower()` FNV-1a hash.
+ */
+
+#include "StreamEx.h"
+#include <ctype.h>
+
+using namespace StreamEx_utility;
+
+constexpr uint32_t ITERATIONS = 2000;
+
+const char* keysA[] = { "true", "FALSE", "SET_SAMPLE_RATE", "motor.left.pid.kp", "CALIBRATION_OFFSET_Z_AXIS" };
+const char* keysB[] = { "TRUE", "false", "set_sample_rate", "MOTOR.LEFT.PID.KP", "calibration_offset_z_axis" };
+constexpr size_t KEY_COUNT = sizeof(keysA) / sizeof(keysA[0]);
+
+// Baseline: the byte-at-a-time comparison StreamEx used before.
+bool iequalBytewise(const char* a, const char* b)
+{
+  while (*a && *b)
+  {
+    if (tolower((unsigned char)*a) != tolower((unsigned char)*b)) return false;
+    ++a; ++b;
+  }
+  return *a == '\0' && *b == '\0';
+}
+
+uint32_t ihashBytewise(const char* s)
+{
+  uint32_t h = 2166136261UL;
+  for (; *s; ++s) h = (h ^ (uint8_t)tolower((unsigned char)*s)) * 16777619UL;
+  return h;
+}
+
+// volatile sink keeps the optimizer from discarding the loops.
+volatile uint32_t sink = 0;
+
+void report(const __FlashStringHelper* name, unsigned long us)
+{
+  Serial.print(name);
+  Serial.print(F(": "));
+  Serial.print(us);
+  Serial.println(F(" us"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  Serial.println(F("Case-fold benchmark"));
+
+  size_t lens[KEY_COUNT];
+  for (size_t k = 0; k < KEY_COUNT; ++k) lens[k] = strlen(keysA[k]);
+
+  unsigned long t0 = micros();
+  for (uint32_t i = 0; i < ITERATIONS; ++i)
+    for (size_t k = 0; k < KEY_COUNT; ++k) sink += iequalBytewise(keysA[k], keysB[k]);
+  report(F("iequal (bytewise tolower)"), micros() - t0);
+
+  t0 = micros();
+  for (uint32_t i = 0; i < ITERATIONS; ++i)
+    for (size_t k = 0; k < KEY_COUNT; ++k) sink += iequal(keysA[k], keysB[k]);
+  report(F("iequal (word-at-a-time)  "), micros() - t0);
+
+  t0 = micros();
+  for (uint32_t i = 0; i < ITERATIONS; ++i)
+    for (size_t k = 0; k < KEY_COUNT; ++k) sink += iequalN(keysA[k], keysB[k], lens[k]);
+  report(F("iequalN (known length)   "), micros() - t0);
+
+  t0 = micros();
+  for (uint32_t i = 0; i < ITERATIONS; ++i)
+    for (size_t k = 0; k < KEY_COUNT; ++k) sink += ihashBytewise(keysA[k]);
+  report(F("hash (bytewise tolower)  "), micros() - t0);
+
+  t0 = micros();
+  for (uint32_t i = 0; i < ITERATIONS; ++i)
+    for (size_t k = 0; k < KEY_COUNT; ++k) sink += ihashN(keysA[k], lens[k]);
+  report(F("ihashN (word-at-a-time)  "), micros() - t0);
+}
+
+void loop() {
+  // One-time benchmark in setup()
+}
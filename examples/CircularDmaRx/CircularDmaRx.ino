@@ -0,0 +1,79 @@
+/**
+ * @file CircularDmaRx.ino
+ * @brief Zero-copy RX from a circular DMA ring, parsed in place by the command registry.
+ *
+ * This sketch shows:
+ *  - `setRxDmaRing()` adopting the ring a circular DMA channel writes.
+ *  - `rxDmaPosition()` as it would be called from the half-transfer, transfer-complete
+ *    and idle-line interrupts.
+ *  - `StreamExCommandTable::process()` parsing straight out of the ring, including lines
+ *    that wrap (the slack after the ring keeps them contiguous).
+ *
+ * The DMA engine is simulated in software (a few bytes per `loop()`), so the sketch
+ * runs unchanged on a host build; on an STM32 start `HAL_UARTEx_ReceiveToIdle_DMA()`
+ * in circular mode and call `link.rxDmaPosition(Size)` from `HAL_UARTEx_RxEventCallback()`.
+ */
+
+#include "StreamEx.h"
+#include "StreamExCommand.h"
+
+constexpr uint32_t RING_SIZE  = 64;
+constexpr uint32_t RING_SLACK = 24;   // longest line that may straddle the wrap
+
+char ring[RING_SIZE + RING_SLACK];
+StreamEx link;
+
+uint16_t rate = 0;
+float    gain = 0.0f;
+
+void onRate(const dataValue&, void*) { Serial.print("RATE="); Serial.println(rate); }
+
+const StreamExCommand cmds[] = {
+  StreamExCommand("RATE", uint16Type, &rate, 0, onRate),
+  StreamExCommand("GAIN", floatType,  &gain),
+};
+uint8_t slots[4];
+StreamExCommandTable table(cmds, 2, slots, sizeof(slots));
+
+// Stand-in for a UART RX DMA channel in circular mode: BYTES_PER_TICK bytes per loop(),
+// with the half/full events at the ring midpoint and end, and an idle event after each burst.
+struct SimulatedDma
+{
+  static constexpr uint32_t BYTES_PER_TICK = 5;
+  uint32_t position = 0;
+  char     line[24];
+  uint32_t lineSize = 0;
+  uint32_t lineSent = 0;
+  uint16_t next     = 0;
+
+  void tick(StreamEx& stream)
+  {
+    if (lineSent == lineSize)
+    {
+      memcpy(line, "RATE=", 5);
+      lineSize = 5 + (uint32_t)StreamEx_utility::format<uint16_t>(line + 5, sizeof(line) - 6, next++);
+      line[lineSize++] = '\n';
+      lineSent = 0;
+    }
+    for (uint32_t i = 0; i < BYTES_PER_TICK && lineSent < lineSize; ++i)
+    {
+      ring[position++] = line[lineSent++];
+      if (position == RING_SIZE / 2) stream.rxDmaPosition(position);              // half-transfer IRQ
+      if (position == RING_SIZE) { position = 0; stream.rxDmaPosition(RING_SIZE); } // transfer-complete IRQ
+    }
+    stream.rxDmaPosition(position);                                                // idle-line IRQ
+  }
+} dma;
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  link.setRxDmaRing(ring, RING_SIZE, RING_SLACK);
+  table.begin();
+}
+
+void loop() {
+  dma.tick(link);
+  table.process(link);   // dispatches every complete line, no copy out of the ring
+}
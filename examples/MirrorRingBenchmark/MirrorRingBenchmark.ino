@@ -0,0 +1,80 @@
+/**
+ * @file MirrorRingBenchmark.ino
+ * @brief Compare consuming from a large linear RX buffer with a mirrored ring (Linux host builds).
+ *
+ * This sketch times the same producer/consumer pattern on a 4 MiB RX buffer:
+ *  - linear mode: every `removeFrontRxBuffer()` shifts the backlog with `memmove`;
+ *  - mirrored mode (`StreamExMirrorRing` + `setRxMirror()`): consuming moves a pointer,
+ *    and the readable data is still one flat run for the line scan.
+ *
+ * The backlog is kept large on purpose, which is where the linear layout hurts.
+ */
+
+#include "StreamEx.h"
+#include "StreamExMirror.h"
+
+#if defined(__linux__)
+
+constexpr uint32_t BUFFER_SIZE = 4UL << 20;
+constexpr uint32_t BACKLOG     = 3UL << 20;   // bytes kept unread while consuming
+constexpr uint32_t ROUNDS      = 2000;
+constexpr uint32_t CHUNK       = 1024;        // bytes produced and consumed per round
+
+static char linearMemory[BUFFER_SIZE];
+StreamExMirrorRing mirror(BUFFER_SIZE);
+
+// volatile sink keeps the optimizer from discarding the work.
+volatile uint32_t sink = 0;
+
+unsigned long run(StreamEx& link)
+{
+  char chunk[CHUNK];
+  for (uint32_t i = 0; i < CHUNK; ++i) chunk[i] = (i % 64 == 63) ? '\n' : (char)('a' + i % 26);
+  while (link.availableRx() < BACKLOG) link.pushBackRxBuffer(chunk, CHUNK);
+
+  const unsigned long t0 = micros();
+  for (uint32_t r = 0; r < ROUNDS; ++r)
+  {
+    link.pushBackRxBuffer(chunk, CHUNK);
+    const char* nl = static_cast<const char*>(memchr(link.getRxBuffer(), '\n', link.availableRx()));
+    sink += (uint32_t)(nl - link.getRxBuffer());
+    link.removeFrontRxBuffer(CHUNK);
+  }
+  return micros() - t0;
+}
+
+void report(const __FlashStringHelper* name, unsigned long us)
+{
+  Serial.print(name);
+  Serial.print(F(": "));
+  Serial.print(us);
+  Serial.print(F(" us, "));
+  Serial.print(us ? (unsigned long)((uint64_t)ROUNDS * CHUNK * 1000000ULL / us) : 0UL);
+  Serial.println(F(" bytes/s consumed"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  Serial.println(F("Mirrored ring benchmark (4 MiB RX, 3 MiB backlog)"));
+
+  StreamEx linear(nullptr, 0, linearMemory, sizeof(linearMemory));
+  report(F("linear  "), run(linear));
+
+  if (!mirror.valid()) { Serial.println(F("mirror mapping failed")); return; }
+  StreamEx ring;
+  ring.setRxMirror(mirror.data(), mirror.size());
+  report(F("mirrored"), run(ring));
+}
+
+#else
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println(F("StreamExMirrorRing needs a Linux host build."));
+}
+
+#endif
+
+void loop() {}
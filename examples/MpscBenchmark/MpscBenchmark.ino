@@ -0,0 +1,134 @@
+/**
+ * @file MpscBenchmark.ino
+ * @brief Contention benchmark: mutex-wrapped `pushBackTxBuffer()` vs. the lock-free MPSC queue.
+ *
+ * For 1 to 32 producer threads, each run pushes the same total number of 32-byte
+ * telemetry records while one transmitter thread drains them:
+ *  - mutex:  producers lock a `std::mutex` around `pushBackTxBuffer()`, the transmitter
+ *            locks it around `popFrontTxBuffer()`;
+ *  - mpsc:   producers `push()` into a ::StreamExMpscQueue, the transmitter uses
+ *            `front()` / `pop()` without any lock.
+ *
+ * Needs a host build with threads (Linux); results depend heavily on the core count.
+ */
+
+#include "StreamExMpsc.h"
+
+#if defined(__linux__)
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+constexpr uint32_t TOTAL_RECORDS = 200000;
+constexpr uint32_t RECORD_SIZE   = 32;
+constexpr uint32_t BUFFER_SIZE   = 1 << 16;
+
+char txMemory[BUFFER_SIZE];
+alignas(4) uint8_t queueMemory[BUFFER_SIZE];
+
+// volatile sink keeps the optimizer from discarding the work.
+volatile uint32_t sink = 0;
+
+unsigned long runMutex(uint32_t producers)
+{
+  StreamEx link(txMemory, sizeof(txMemory), nullptr, 0);
+  std::mutex lock;
+  const uint32_t perProducer = TOTAL_RECORDS / producers;
+
+  const unsigned long t0 = micros();
+  std::vector<std::thread> threads;
+  for (uint32_t p = 0; p < producers; ++p)
+    threads.emplace_back([&, p] {
+      char record[RECORD_SIZE];
+      memset(record, 'A' + (int)p, sizeof(record));
+      for (uint32_t i = 0; i < perProducer; )
+      {
+        {
+          std::lock_guard<std::mutex> guard(lock);
+          if (link.freeTx() >= RECORD_SIZE) { link.pushBackTxBuffer(record, RECORD_SIZE); ++i; continue; }
+        }
+        std::this_thread::yield();
+      }
+    });
+
+  char record[RECORD_SIZE];
+  for (uint32_t received = 0; received < perProducer * producers; )
+  {
+    bool got = false;
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      if (link.availableTx() >= RECORD_SIZE) got = link.popFrontTxBuffer(record, RECORD_SIZE);
+    }
+    if (got) { sink += (uint8_t)record[0]; ++received; }
+    else std::this_thread::yield();
+  }
+  for (std::thread& t : threads) t.join();
+  return micros() - t0;
+}
+
+unsigned long runMpsc(uint32_t producers)
+{
+  StreamExMpscQueue queue(queueMemory, sizeof(queueMemory));
+  const uint32_t perProducer = TOTAL_RECORDS / producers;
+
+  const unsigned long t0 = micros();
+  std::vector<std::thread> threads;
+  for (uint32_t p = 0; p < producers; ++p)
+    threads.emplace_back([&, p] {
+      char record[RECORD_SIZE];
+      memset(record, 'A' + (int)p, sizeof(record));
+      for (uint32_t i = 0; i < perProducer; )
+      {
+        if (queue.push(record, RECORD_SIZE)) ++i;
+        else std::this_thread::yield();
+      }
+    });
+
+  for (uint32_t received = 0; received < perProducer * producers; )
+  {
+    uint32_t size;
+    const char* record = queue.front(&size);
+    if (record) { sink += (uint8_t)record[0]; queue.pop(); ++received; }
+    else std::this_thread::yield();
+  }
+  for (std::thread& t : threads) t.join();
+  return micros() - t0;
+}
+
+void report(uint32_t producers, const __FlashStringHelper* name, unsigned long us)
+{
+  Serial.print(producers);
+  Serial.print(F(" producers, "));
+  Serial.print(name);
+  Serial.print(F(": "));
+  Serial.print(us);
+  Serial.print(F(" us, "));
+  Serial.print(us ? (unsigned long)((uint64_t)TOTAL_RECORDS * 1000000ULL / us) : 0UL);
+  Serial.println(F(" records/s"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  Serial.print(F("MPSC TX benchmark, hardware threads: "));
+  Serial.println((unsigned long)std::thread::hardware_concurrency());
+
+  for (uint32_t producers = 1; producers <= 32; producers *= 2)
+  {
+    report(producers, F("mutex"), runMutex(producers));
+    report(producers, F("mpsc "), runMpsc(producers));
+  }
+}
+
+#else
+
+void setup() {
+  Serial.begin(115200);
+  Serial.println(F("MpscBenchmark needs a host build with threads."));
+}
+
+#endif
+
+void loop() {}
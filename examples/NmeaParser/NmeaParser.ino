@@ -0,0 +1,66 @@
+/**
+ * @file NmeaParser.ino
+ * @brief Parse GGA/RMC sentences from a GPS module with StreamExNmea.
+ *
+ * This sketch shows:
+ *  - Feeding received bytes into a StreamEx RX buffer.
+ *  - Verifying and decoding NMEA sentences without copying fields.
+ *  - Using fixed-point coordinates (degrees x 1e7).
+ *
+ * A canned sentence is fed once at startup so the sketch prints something
+ * without hardware; in a real project push bytes read from the GPS UART.
+ */
+
+#include "StreamExNmea.h"
+
+char rxBuffer[256];
+StreamEx gps(nullptr, 0, rxBuffer, sizeof(rxBuffer));
+StreamExNmea nmea;
+
+void printDegrees(int32_t e7)
+{
+  if (e7 < 0) { Serial.print('-'); e7 = -e7; }
+  Serial.print((long)(e7 / 10000000L));
+  Serial.print('.');
+  long f = (long)(e7 % 10000000L);
+  for (long div = 1000000L; div > 0; div /= 10) Serial.print((char)('0' + (f / div) % 10));
+}
+
+void onGga(const StreamExNmeaGga& gga, void*)
+{
+  Serial.print(F("GGA fix="));
+  Serial.print(gga.fixQuality);
+  Serial.print(F(" sats="));
+  Serial.print(gga.satellites);
+  Serial.print(F(" lat="));
+  printDegrees(gga.latitude);
+  Serial.print(F(" lon="));
+  printDegrees(gga.longitude);
+  Serial.println();
+}
+
+void onRmc(const StreamExNmeaRmc& rmc, void*)
+{
+  Serial.print(F("RMC active="));
+  Serial.print(rmc.active ? 1 : 0);
+  Serial.print(F(" speed(mkn)="));
+  Serial.println((unsigned long)rmc.speedMilliKnots);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  nmea.onGga(onGga);
+  nmea.onRmc(onRmc);
+
+  const char* sample =
+    "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n"
+    "$GNRMC,123519.25,A,4807.038,S,01131.000,W,022.4,084.4,230394,003.1,W*52\r\n";
+  gps.pushBackRxBuffer(sample, strlen(sample));
+}
+
+void loop() {
+  // Real hardware: while (Serial1.available()) { char c = Serial1.read(); gps.pushBackRxBuffer(&c, 1); }
+  nmea.process(gps);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file PingPongDma.ino
+ * @brief Double-buffered TX: keep appending while a (simulated) DMA sends the other half.
+ *
+ * This sketch shows:
+ *  - `setTxPingPong()` with two static halves.
+ *  - `txDmaStart()` handing the filled half to the transport without copying.
+ *  - `txDmaComplete()` as it would be called from the DMA transfer-complete interrupt.
+ *
+ * The DMA engine is simulated in software (a few bytes per `loop()`), so the sketch
+ * runs unchanged on a host build; on hardware replace `SimulatedDma` with
+ * `HAL_UART_Transmit_DMA()` / `uart_write_bytes()` and call `txDmaComplete()` from
+ * the completion callback.
+ */
+
+#include "StreamEx.h"
+
+char halfA[64];
+char halfB[64];
+StreamEx link;
+
+// Stand-in for a UART TX DMA channel: sends BYTES_PER_TICK bytes per loop().
+struct SimulatedDma
+{
+  static constexpr uint32_t BYTES_PER_TICK = 7;
+  const char* region = nullptr;
+  uint32_t    size   = 0;
+  uint32_t    sent   = 0;
+
+  void start(const char* data, uint32_t n) { region = data; size = n; sent = 0; }
+
+  void tick(StreamEx& stream)
+  {
+    if (!region) return;
+    const uint32_t n = (size - sent < BYTES_PER_TICK) ? (size - sent) : BYTES_PER_TICK;
+    Serial.write(reinterpret_cast<const uint8_t*>(region + sent), n);
+    sent += n;
+    if (sent == size) { region = nullptr; stream.txDmaComplete(); }   // "transfer complete" IRQ
+  }
+} dma;
+
+uint32_t counter = 0;
+
+void kickDma()
+{
+  uint32_t n = 0;
+  const char* region = link.txDmaStart(&n);
+  if (region) dma.start(region, n);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  link.setTxPingPong(halfA, halfB, sizeof(halfA));
+}
+
+void loop() {
+  // Application side: append freely, even while the other half is being sent.
+  if (counter < 20 && link.freeTx() >= 16)
+  {
+    char line[16];
+    const size_t len = StreamEx_utility::format<uint32_t>(line, sizeof(line), counter++);
+    link.pushBackTxBuffer(line, (uint32_t)len);
+    link.pushBackTxBuffer("\n", 1);
+  }
+
+  dma.tick(link);
+  kickDma();   // no-op while a transfer is in flight
+}
@@ -0,0 +1,122 @@
+/**
+ * @file PollJitter.ino
+ * @brief Loop jitter with per-handler `read()` loops vs. the budgeted ::StreamExPoller.
+ *
+ * Three simulated links feed three protocol handlers; one of them is slow (heavy
+ * per-byte work) and receives bursts. The sketch runs the same traffic twice:
+ *  - naive:  every handler drains its stream with `available()` / `read()`;
+ *  - poller: `poll(BUDGET)` with the same handlers as cooperative steps.
+ *
+ * It prints the average and worst `loop()` pass. With the poller the worst pass is
+ * bounded by the budget instead of by the size of the largest burst.
+ */
+
+#include "StreamExPoll.h"
+
+constexpr uint32_t PASSES = 2000;
+constexpr uint32_t BURST  = 400;   // bytes dumped on the slow link every BURST_EVERY passes
+constexpr uint32_t BURST_EVERY = 50;
+constexpr uint32_t BUDGET = 48;    // bytes of protocol work per poller pass
+
+char tx[3][64];
+char rx[3][512];
+StreamEx links[3] = {
+  StreamEx(tx[0], sizeof(tx[0]), rx[0], sizeof(rx[0])),
+  StreamEx(tx[1], sizeof(tx[1]), rx[1], sizeof(rx[1])),
+  StreamEx(tx[2], sizeof(tx[2]), rx[2], sizeof(rx[2])),
+};
+
+// volatile sink keeps the optimizer from discarding the work.
+volatile uint32_t sink = 0;
+
+// Per-byte work of each protocol: line counting (cheap) and a heavy "decoder".
+void cheapByte(char c) { if (c == '\n') ++sink; }
+void slowByte(char c)
+{
+  uint32_t h = (uint8_t)c;
+  for (int i = 0; i < 400; ++i) h = h * 1103515245u + 12345u;
+  sink += h;
+}
+
+uint32_t cheapStep(StreamEx&, const char* data, uint32_t size, void*)
+{
+  for (uint32_t i = 0; i < size; ++i) cheapByte(data[i]);
+  return size;
+}
+
+uint32_t slowStep(StreamEx&, const char* data, uint32_t size, void*)
+{
+  for (uint32_t i = 0; i < size; ++i) slowByte(data[i]);
+  return size;
+}
+
+StreamExPollHandler handlers[] = {
+  StreamExPollHandler(&links[0], cheapStep, nullptr, 16),
+  StreamExPollHandler(&links[1], cheapStep, nullptr, 16),
+  StreamExPollHandler(&links[2], slowStep,  nullptr, 16),
+};
+StreamExPoller poller(handlers, 3);
+
+void feed(uint32_t pass)
+{
+  links[0].pushBackRxBuffer("$GPGGA,1\n", 9);
+  links[1].pushBackRxBuffer("T=21\n", 5);
+  if (pass % BURST_EVERY == 0)
+  {
+    char burst[BURST];
+    memset(burst, 'x', sizeof(burst));
+    links[2].pushBackRxBuffer(burst, sizeof(burst));
+  }
+}
+
+void naivePass()
+{
+  while (links[0].available()) cheapByte((char)links[0].read());
+  while (links[1].available()) cheapByte((char)links[1].read());
+  while (links[2].available()) slowByte((char)links[2].read());
+}
+
+void report(const __FlashStringHelper* name, unsigned long total, unsigned long worst)
+{
+  Serial.print(name);
+  Serial.print(F(": avg "));
+  Serial.print(total / PASSES);
+  Serial.print(F(" us, worst "));
+  Serial.print(worst);
+  Serial.println(F(" us per loop() pass"));
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) { ; }
+
+  unsigned long total = 0, worst = 0;
+  for (uint32_t pass = 0; pass < PASSES; ++pass)
+  {
+    feed(pass);
+    const unsigned long t0 = micros();
+    naivePass();
+    const unsigned long us = micros() - t0;
+    total += us;
+    if (us > worst) worst = us;
+  }
+  report(F("naive "), total, worst);
+
+  poller.resetStats();
+  total = 0;
+  for (uint32_t pass = 0; pass < PASSES; ++pass)
+  {
+    feed(pass);
+    poller.poll(BUDGET);
+    total += poller.lastPollUs();
+  }
+  report(F("poller"), total, poller.maxPollUs());
+
+  Serial.print(F("poller backlog left: "));
+  Serial.print(poller.backlog());
+  Serial.print(F(" bytes, slowest step: "));
+  Serial.print(handlers[2].maxStepUs);
+  Serial.println(F(" us"));
+}
+
+void loop() {}